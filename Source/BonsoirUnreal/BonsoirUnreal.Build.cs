@@ -15,6 +15,7 @@ public class BonsoirUnreal : ModuleRules
 			"MeshUtilities", 
 			"MeshUtilities", 
 			"MeshUtilitiesCommon",
+			"MeshMergeUtilities",
 			"Slate",
 			"SlateCore",
 			"EditorStyle",
@@ -22,7 +23,9 @@ public class BonsoirUnreal : ModuleRules
 			"Projects",
 		"UnrealEd",
 		"AssetTools",
-		"ContentBrowser"
+		"ContentBrowser",
+		"DeveloperSettings",
+		"EditorSubsystem"
 		});
 
 		// Uncomment if you are using Slate UI
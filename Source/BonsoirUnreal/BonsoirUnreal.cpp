@@ -6,6 +6,7 @@
 #include "Framework/Commands/Commands.h"
 #include "IDesktopPlatform.h"
 #include "Misc/MessageDialog.h"
+#include "RoseImportSession.h"
 #include "RoseImporter.h"
 #include "ToolMenus.h"
 
@@ -99,9 +100,12 @@ void FBonsoirUnrealModule::OnImportZoneClicked() {
 
         // Handle STB
         if (Ext == TEXT("stb")) {
-          FRoseSTB Stb;
-          if (Stb.Load(FilePath)) {
-            TSharedPtr<FZoneRow> Selected = SRoseZoneBrowser::PickZone(Stb);
+          // Parsed once per editor session, shared with the importer
+          URoseImportSession *Session = URoseImportSession::Get();
+          TSharedPtr<const FRoseSTB> Stb =
+              Session ? Session->GetSTB(FilePath) : nullptr;
+          if (Stb) {
+            TSharedPtr<FZoneRow> Selected = SRoseZoneBrowser::PickZone(*Stb);
             if (Selected.IsValid()) {
               // Resolve Path logic (same as Factory)
               FString ParentDir = FPaths::GetPath(FilePath);
@@ -1,3 +1,7 @@
 #include "BonsoirUnrealLog.h"
 
 DEFINE_LOG_CATEGORY(LogRoseImporter);
+
+DEFINE_STAT(STAT_RoseAnimTick);
+DEFINE_STAT(STAT_RoseAnimEvaluated);
+DEFINE_STAT(STAT_RoseAnimSkipped);
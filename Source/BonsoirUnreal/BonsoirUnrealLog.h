@@ -3,3 +3,15 @@
 #include "CoreMinimal.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogRoseImporter, Log, All);
+
+// Runtime cost of animated zone props ("stat RoseImporter")
+DECLARE_STATS_GROUP(TEXT("RoseImporter"), STATGROUP_RoseImporter,
+                    STATCAT_Advanced);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Anim Props Tick"), STAT_RoseAnimTick,
+                          STATGROUP_RoseImporter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Anim Props Evaluated"),
+                                  STAT_RoseAnimEvaluated,
+                                  STATGROUP_RoseImporter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Anim Props Skipped"),
+                                  STAT_RoseAnimSkipped,
+                                  STATGROUP_RoseImporter, );
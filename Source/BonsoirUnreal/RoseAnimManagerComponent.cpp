@@ -0,0 +1,182 @@
+#include "RoseAnimManagerComponent.h"
+#include "Async/ParallelFor.h"
+#include "BonsoirUnrealLog.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "RoseFormats.h"
+
+// Below this many instances evaluation stays on the game thread
+static constexpr int32 RoseAnimParallelThreshold = 256;
+
+URoseAnimManagerComponent::URoseAnimManagerComponent() {
+  PrimaryComponentTick.bCanEverTick = true;
+  PrimaryComponentTick.bStartWithTickEnabled = true;
+  bTickInEditor = true; // Run in editor viewport
+}
+
+int32 URoseAnimManagerComponent::AddClip(const FString &ClipKey,
+                                         const FRoseAnimClip &Clip) {
+  if (const int32 *Found = ClipLookup.Find(ClipKey)) {
+    return *Found;
+  }
+
+  FRoseAnimClipRange Range;
+  Range.FPS = Clip.FPS;
+  Range.FrameCount = Clip.FrameCount;
+  Range.PosStart = PosKeys.Num();
+  Range.PosNum = Clip.PosKeys.Num();
+  PosKeys.Append(Clip.PosKeys);
+  Range.RotStart = RotKeys.Num();
+  Range.RotNum = Clip.RotKeys.Num();
+  RotKeys.Append(Clip.RotKeys);
+  Range.ScaleStart = ScaleKeys.Num();
+  Range.ScaleNum = Clip.ScaleKeys.Num();
+  ScaleKeys.Append(Clip.ScaleKeys);
+
+  const int32 Index = Clips.Add(Range);
+  ClipLookup.Add(ClipKey, Index);
+  return Index;
+}
+
+UInstancedStaticMeshComponent *
+URoseAnimManagerComponent::GetOrCreateGroup(UStaticMesh *Mesh,
+                                            int32 &OutGroup) {
+  if (const int32 *Found = GroupLookup.Find(Mesh)) {
+    OutGroup = *Found;
+    return Groups[OutGroup];
+  }
+
+  AActor *Owner = GetOwner();
+  FName ISMName = MakeUniqueObjectName(
+      Owner, UInstancedStaticMeshComponent::StaticClass(),
+      FName(*(TEXT("AnimISM_") + Mesh->GetName())));
+  UInstancedStaticMeshComponent *ISM =
+      NewObject<UInstancedStaticMeshComponent>(Owner, ISMName);
+  ISM->SetStaticMesh(Mesh);
+  ISM->SetMobility(EComponentMobility::Movable);
+  if (Owner->GetRootComponent()) {
+    ISM->AttachToComponent(Owner->GetRootComponent(),
+                           FAttachmentTransformRules::KeepRelativeTransform);
+  }
+  ISM->RegisterComponent();
+  Owner->AddInstanceComponent(ISM);
+
+  OutGroup = Groups.Add(ISM);
+  GroupLookup.Add(Mesh, OutGroup);
+  return ISM;
+}
+
+void URoseAnimManagerComponent::AddInstance(UStaticMesh *Mesh, int32 Clip,
+                                            const FTransform &Base) {
+  if (!Mesh || !Clips.IsValidIndex(Clip))
+    return;
+
+  int32 Group = INDEX_NONE;
+  UInstancedStaticMeshComponent *ISM = GetOrCreateGroup(Mesh, Group);
+
+  InstanceClip.Add(Clip);
+  InstanceGroup.Add(Group);
+  InstanceIndexInGroup.Add(ISM->AddInstance(Base, /*bWorldSpace=*/false));
+  InstanceBase.Add(Base);
+  // Identical props placed side by side must not move in lockstep
+  FRandomStream Phase(GetTypeHash(Base.GetLocation()));
+  InstancePhase.Add(Phase.FRand() * (float)Clips[Clip].FrameCount /
+                    (float)FMath::Max(1, Clips[Clip].FPS));
+  bLayoutDirty = true;
+}
+
+void URoseAnimManagerComponent::UpdateLayout() {
+  // Evaluated holds each group's instances contiguously, in the same order
+  // as the group's instanced component
+  TArray<int32> GroupCount;
+  GroupCount.SetNumZeroed(Groups.Num());
+  for (int32 Group : InstanceGroup) {
+    GroupCount[Group]++;
+  }
+
+  GroupStart.SetNumUninitialized(Groups.Num());
+  int32 Offset = 0;
+  for (int32 g = 0; g < Groups.Num(); ++g) {
+    GroupStart[g] = Offset;
+    Offset += GroupCount[g];
+  }
+  Evaluated.SetNum(Offset);
+  bLayoutDirty = false;
+}
+
+void URoseAnimManagerComponent::TickComponent(
+    float DeltaTime, ELevelTick TickType,
+    FActorComponentTickFunction *ThisTickFunction) {
+  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  SCOPE_CYCLE_COUNTER(STAT_RoseAnimTick);
+
+  const int32 NumInstances = InstanceClip.Num();
+  if (NumInstances == 0)
+    return;
+  if (bLayoutDirty) {
+    UpdateLayout();
+  }
+
+  ElapsedTime += DeltaTime;
+
+  ParallelFor(
+      NumInstances,
+      [this](int32 i) {
+        const FRoseAnimClipRange &Clip = Clips[InstanceClip[i]];
+        FTransform Local = FTransform::Identity;
+
+        if (Clip.FrameCount > 0 && Clip.FPS > 0) {
+          const double Duration = (double)Clip.FrameCount / Clip.FPS;
+          // Managers saved before phases were stored start in sync
+          const float Phase =
+              InstancePhase.IsValidIndex(i) ? InstancePhase[i] : 0.0f;
+          const float FrameF =
+              (float)FMath::Fmod(ElapsedTime + Phase, Duration) * Clip.FPS;
+          const int32 Frame0 = FMath::FloorToInt(FrameF);
+          const float Alpha = FrameF - (float)Frame0;
+
+          if (Clip.PosNum > 0) {
+            const int32 F0 = FMath::Min(Frame0, Clip.PosNum - 1);
+            const int32 F1 = FMath::Min(F0 + 1, Clip.PosNum - 1);
+            Local.SetLocation((FVector)FMath::Lerp(
+                PosKeys[Clip.PosStart + F0], PosKeys[Clip.PosStart + F1],
+                Alpha));
+          }
+          if (Clip.RotNum > 0) {
+            const int32 F0 = FMath::Min(Frame0, Clip.RotNum - 1);
+            const int32 F1 = FMath::Min(F0 + 1, Clip.RotNum - 1);
+            Local.SetRotation((FQuat)FQuat4f::Slerp(
+                RotKeys[Clip.RotStart + F0], RotKeys[Clip.RotStart + F1],
+                Alpha));
+          }
+          if (Clip.ScaleNum > 0) {
+            const int32 F0 = FMath::Min(Frame0, Clip.ScaleNum - 1);
+            const int32 F1 = FMath::Min(F0 + 1, Clip.ScaleNum - 1);
+            Local.SetScale3D((FVector)FMath::Lerp(
+                ScaleKeys[Clip.ScaleStart + F0],
+                ScaleKeys[Clip.ScaleStart + F1], Alpha));
+          }
+        }
+
+        // Keys are relative to the placement, like the per-actor path
+        Evaluated[GroupStart[InstanceGroup[i]] + InstanceIndexInGroup[i]] =
+            Local * InstanceBase[i];
+      },
+      NumInstances < RoseAnimParallelThreshold
+          ? EParallelForFlags::ForceSingleThread
+          : EParallelForFlags::None);
+  INC_DWORD_STAT_BY(STAT_RoseAnimEvaluated, NumInstances);
+
+  for (int32 g = 0; g < Groups.Num(); ++g) {
+    UInstancedStaticMeshComponent *ISM = Groups[g];
+    const int32 Count = (g + 1 < Groups.Num() ? GroupStart[g + 1]
+                                              : Evaluated.Num()) -
+                        GroupStart[g];
+    if (!ISM || Count == 0)
+      continue;
+    ISM->BatchUpdateInstancesTransforms(
+        0, MakeArrayView(Evaluated.GetData() + GroupStart[g], Count),
+        /*bWorldSpace=*/false, /*bMarkRenderStateDirty=*/true,
+        /*bTeleport=*/true);
+  }
+}
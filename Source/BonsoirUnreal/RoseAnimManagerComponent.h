@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "CoreMinimal.h"
+#include "RoseAnimManagerComponent.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+struct FRoseAnimClip;
+
+/**
+ * Where one ZMO clip's root-bone keys live in the manager's packed arrays.
+ * A channel the clip does not animate has a zero key count.
+ */
+USTRUCT()
+struct FRoseAnimClipRange {
+  GENERATED_BODY()
+
+  UPROPERTY()
+  int32 FPS = 30;
+  UPROPERTY()
+  int32 FrameCount = 0;
+  UPROPERTY()
+  int32 PosStart = 0;
+  UPROPERTY()
+  int32 PosNum = 0;
+  UPROPERTY()
+  int32 RotStart = 0;
+  UPROPERTY()
+  int32 RotNum = 0;
+  UPROPERTY()
+  int32 ScaleStart = 0;
+  UPROPERTY()
+  int32 ScaleNum = 0;
+};
+
+/**
+ * Drives every animated zone object with a single tick.
+ * Clips are packed once into shared key arrays and instances are stored as
+ * parallel arrays. Each mesh gets one instanced component, updated with a
+ * single batched transform write per frame.
+ */
+UCLASS()
+class BONSOIRUNREAL_API URoseAnimManagerComponent : public UActorComponent {
+  GENERATED_BODY()
+
+public:
+  URoseAnimManagerComponent();
+
+  // Packs a clip's keys, once per key (normalized ZMO path)
+  int32 AddClip(const FString &ClipKey, const FRoseAnimClip &Clip);
+
+  // Adds an instance of Mesh playing Clip, placed at Base. The start phase
+  // is seeded from the location like the per-actor and WPO paths
+  void AddInstance(UStaticMesh *Mesh, int32 Clip, const FTransform &Base);
+
+  int32 GetNumInstances() const { return InstanceClip.Num(); }
+  int32 GetNumClips() const { return Clips.Num(); }
+
+  virtual void
+  TickComponent(float DeltaTime, ELevelTick TickType,
+                FActorComponentTickFunction *ThisTickFunction) override;
+
+private:
+  UInstancedStaticMeshComponent *GetOrCreateGroup(UStaticMesh *Mesh,
+                                                  int32 &OutGroup);
+  void UpdateLayout();
+
+  // Packed clip keys (root bone only)
+  UPROPERTY()
+  TArray<FRoseAnimClipRange> Clips;
+  UPROPERTY()
+  TArray<FVector3f> PosKeys;
+  UPROPERTY()
+  TArray<FQuat4f> RotKeys;
+  UPROPERTY()
+  TArray<FVector3f> ScaleKeys;
+
+  // Per-instance data, one entry per animated object
+  UPROPERTY()
+  TArray<int32> InstanceClip;
+  UPROPERTY()
+  TArray<int32> InstanceGroup;
+  UPROPERTY()
+  TArray<int32> InstanceIndexInGroup;
+  UPROPERTY()
+  TArray<FTransform> InstanceBase;
+  UPROPERTY()
+  TArray<float> InstancePhase; // Seconds into the clip at time 0
+
+  // One instanced component per mesh
+  UPROPERTY()
+  TArray<UInstancedStaticMeshComponent *> Groups;
+
+  // Not saved: rebuilt from the arrays above
+  TMap<FString, int32> ClipLookup;
+  TMap<UStaticMesh *, int32> GroupLookup;
+  TArray<int32> GroupStart;
+  TArray<FTransform> Evaluated;
+  bool bLayoutDirty = true;
+
+  // Never wrapped: a shared period would cut clips mid-loop. Each instance
+  // wraps by its own clip duration, in double for long sessions
+  double ElapsedTime = 0.0;
+};
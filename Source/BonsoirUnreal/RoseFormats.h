@@ -2,6 +2,7 @@
 
 #include "BonsoirUnrealLog.h"
 #include "CoreMinimal.h"
+#include "Misc/Paths.h"
 #include "Serialization/Archive.h"
 
 // Helper struct for reading ROSE strings
@@ -100,22 +101,31 @@ struct FRoseArchive : public FArchive {
 
 /**
  * STB (String Table) Format
- * Used for ZONETYPEINFO.STB and TileSet files
+ * Used for ZONETYPEINFO.STB, LIST_ZONE.STB and TileSet files
+ *
+ * The file buffer is kept as loaded and each cell is an offset and length
+ * into it, so loading allocates no strings; GetCell builds one on demand.
+ * Column 0 holds the row names.
  */
 struct FRoseSTB {
-  int32 RowSize;
+  int32 RowSize = 0;
   TArray<int16> ColumnSizes;
   TArray<FString> ColumnNames;
-  TArray<TArray<FString>> Cells; // [Row][Column]
 
   bool Load(const FString &FilePath) {
-    TArray<uint8> FileData;
-    if (!FFileHelper::LoadFileToArray(FileData, *FilePath)) {
+    const double StartTime = FPlatformTime::Seconds();
+    Data.Reset();
+    CellRefs.Reset();
+    RowIndices.Reset();
+    NumRows = 0;
+    NumColumns = 0;
+
+    if (!FFileHelper::LoadFileToArray(Data, *FilePath)) {
       UE_LOG(LogTemp, Warning, TEXT("Failed to load STB file: %s"), *FilePath);
       return false;
     }
 
-    FMemoryReader Ar(FileData);
+    FMemoryReader Ar(Data);
     Ar.SetByteSwapping(false); // Little endian
 
     // Read header "STB1"
@@ -133,6 +143,11 @@ struct FRoseSTB {
     // Read counts
     int32 RowCount, ColumnCount;
     Ar << RowCount << ColumnCount << RowSize;
+    if (RowCount < 1 || ColumnCount < 1 || Ar.IsError()) {
+      UE_LOG(LogTemp, Error, TEXT("Invalid STB size %dx%d: %s"), RowCount,
+             ColumnCount, *FilePath);
+      return false;
+    }
 
     // Read column sizes
     ColumnSizes.SetNum(ColumnCount + 1);
@@ -157,60 +172,125 @@ struct FRoseSTB {
       }
     }
 
-    // Initialize cells array
-    Cells.SetNum(RowCount - 1);
-
-    // Read first column (row names)
-    for (int32 i = 0; i < RowCount - 1; ++i) {
-      Cells[i].SetNum(ColumnCount);
-
-      int16 CellLength;
-      Ar << CellLength;
+    // Cells are length-prefixed: first every row name (column 0), then the
+    // remaining cells row by row
+    NumRows = RowCount - 1;
+    NumColumns = ColumnCount;
+    CellRefs.SetNumUninitialized(NumRows * NumColumns);
+    int64 Offset = Ar.Tell();
+    auto ReadCell = [this, &Offset](int32 Row, int32 Column) {
+      if (Offset + (int64)sizeof(int16) > Data.Num())
+        return false;
+      int16 Length;
+      FMemory::Memcpy(&Length, Data.GetData() + Offset, sizeof(int16));
+      Offset += sizeof(int16);
+      Length = FMath::Max<int16>(Length, 0);
+      if (Offset + Length > Data.Num())
+        return false;
+      CellRefs[Row * NumColumns + Column] = {(int32)Offset, Length};
+      Offset += Length;
+      return true;
+    };
 
-      if (CellLength > 0) {
-        TArray<uint8> CellBuffer;
-        CellBuffer.SetNumUninitialized(CellLength);
-        Ar.Serialize(CellBuffer.GetData(), CellLength);
-        Cells[i][0] =
-            FString(CellLength, (const ANSICHAR *)CellBuffer.GetData());
-      } else {
-        Cells[i][0] = FString();
-      }
+    bool bComplete = !Ar.IsError();
+    for (int32 i = 0; bComplete && i < NumRows; ++i) {
+      bComplete = ReadCell(i, 0);
     }
-
-    // Read remaining cells
-    for (int32 i = 0; i < RowCount - 1; ++i) {
-      for (int32 j = 1; j < ColumnCount; ++j) {
-        int16 CellLength;
-        Ar << CellLength;
-
-        if (CellLength > 0) {
-          TArray<uint8> CellBuffer;
-          CellBuffer.SetNumUninitialized(CellLength);
-          Ar.Serialize(CellBuffer.GetData(), CellLength);
-          Cells[i][j] =
-              FString(CellLength, (const ANSICHAR *)CellBuffer.GetData());
-        } else {
-          Cells[i][j] = FString();
-        }
+    for (int32 i = 0; bComplete && i < NumRows; ++i) {
+      for (int32 j = 1; bComplete && j < NumColumns; ++j) {
+        bComplete = ReadCell(i, j);
       }
     }
+    if (!bComplete) {
+      UE_LOG(LogTemp, Error, TEXT("Truncated STB file: %s"), *FilePath);
+      NumRows = 0;
+      return false;
+    }
 
-    UE_LOG(LogTemp, Log, TEXT("Loaded STB: %d rows, %d columns"), Cells.Num(),
-           ColumnCount);
+    UE_LOG(LogTemp, Log, TEXT("Loaded STB: %d rows, %d columns (%.2f ms)"),
+           NumRows, NumColumns,
+           (FPlatformTime::Seconds() - StartTime) * 1000.0);
     return true;
   }
 
+  // Cell bytes without copying (empty when out of range). Valid while the
+  // STB is alive and not reloaded.
+  FAnsiStringView GetCellView(int32 Row, int32 Column) const {
+    if (Row < 0 || Row >= NumRows || Column < 0 || Column >= NumColumns) {
+      return FAnsiStringView();
+    }
+    const FCellRef &Ref = CellRefs[Row * NumColumns + Column];
+    return FAnsiStringView((const ANSICHAR *)Data.GetData() + Ref.Offset,
+                           Ref.Length);
+  }
+
   FString GetCell(int32 Row, int32 Column) const {
-    if (Row >= 0 && Row < Cells.Num() && Column >= 0 &&
-        Column < Cells[Row].Num()) {
-      return Cells[Row][Column];
+    const FAnsiStringView View = GetCellView(Row, Column);
+    return View.IsEmpty() ? FString() : FString(View.Len(), View.GetData());
+  }
+
+  // Leading integer of a cell, parsed like FCString::Atoi (0 if none)
+  int32 GetCellInt(int32 Row, int32 Column) const {
+    const FAnsiStringView View = GetCellView(Row, Column);
+    int32 i = 0;
+    while (i < View.Len() && FCharAnsi::IsWhitespace(View[i])) {
+      ++i;
+    }
+    const bool bNegative = i < View.Len() && View[i] == '-';
+    if (i < View.Len() && (View[i] == '-' || View[i] == '+')) {
+      ++i;
+    }
+    int64 Value = 0;
+    for (; i < View.Len() && FCharAnsi::IsDigit(View[i]); ++i) {
+      Value = FMath::Min<int64>(Value * 10 + (View[i] - '0'), MAX_uint32);
     }
-    return FString();
+    return (int32)FMath::Clamp<int64>(bNegative ? -Value : Value, MIN_int32,
+                                      MAX_int32);
   }
 
-  int32 GetRowCount() const { return Cells.Num(); }
-  int32 GetColumnCount() const { return Cells.Num() > 0 ? Cells[0].Num() : 0; }
+  // First row whose cell in Column equals Key, ignoring case, or
+  // INDEX_NONE. With bBaseFilename cells are compared by base file name,
+  // so "3DDATA/MAPS/JDT01.ZON" matches "JDT01". Each column's index is
+  // built on first use, which is not thread-safe.
+  int32 FindRow(int32 Column, const FString &Key,
+                bool bBaseFilename = false) const {
+    const TPair<int32, bool> IndexKey(Column, bBaseFilename);
+    const TMap<FString, int32> *Index = RowIndices.Find(IndexKey);
+    if (!Index) {
+      // FString keys hash and compare case-insensitively
+      TMap<FString, int32> &NewIndex = RowIndices.Add(IndexKey);
+      NewIndex.Reserve(NumRows);
+      for (int32 Row = 0; Row < NumRows; ++Row) {
+        FString Cell = GetCell(Row, Column);
+        if (bBaseFilename) {
+          Cell = FPaths::GetBaseFilename(Cell);
+        }
+        if (!Cell.IsEmpty()) {
+          NewIndex.FindOrAdd(MoveTemp(Cell), Row);
+        }
+      }
+      Index = &NewIndex;
+    }
+    const int32 *Row = Index->Find(Key);
+    return Row ? *Row : INDEX_NONE;
+  }
+
+  int32 GetRowCount() const { return NumRows; }
+  int32 GetColumnCount() const { return NumRows > 0 ? NumColumns : 0; }
+
+private:
+  struct FCellRef {
+    int32 Offset;
+    int32 Length;
+  };
+
+  TArray<uint8> Data;
+  TArray<FCellRef> CellRefs; // [Row * NumColumns + Column]
+  int32 NumRows = 0;
+  int32 NumColumns = 0;
+
+  // Row lookup per (column, bBaseFilename), built by FindRow
+  mutable TMap<TPair<int32, bool>, TMap<FString, int32>> RowIndices;
 };
 
 /**
@@ -244,7 +324,7 @@ struct FRoseTileSet {
     }
 
     // Row 0, Column 2: Brush count
-    int32 BrushCount = FCString::Atoi(*STB.GetCell(0, 2));
+    int32 BrushCount = STB.GetCellInt(0, 2);
     if (BrushCount <= 0) {
       UE_LOG(LogTemp, Error, TEXT("Invalid brush count: %d"), BrushCount);
       return false;
@@ -256,15 +336,15 @@ struct FRoseTileSet {
       int32 Row = i + 1;
       FRoseTileBrush &Brush = Brushes[i];
 
-      Brush.MinimumBrush = FCString::Atoi(*STB.GetCell(Row, 2));
-      Brush.MaximumBrush = FCString::Atoi(*STB.GetCell(Row, 3));
-      Brush.TileNumber0 = FCString::Atoi(*STB.GetCell(Row, 4));
-      Brush.TileCount0 = FCString::Atoi(*STB.GetCell(Row, 5));
-      Brush.TileNumberF = FCString::Atoi(*STB.GetCell(Row, 6));
-      Brush.TileCountF = FCString::Atoi(*STB.GetCell(Row, 7));
-      Brush.TileNumber = FCString::Atoi(*STB.GetCell(Row, 8));
-      Brush.TileCount = FCString::Atoi(*STB.GetCell(Row, 9));
-      Brush.Direction = FCString::Atoi(*STB.GetCell(Row, 10));
+      Brush.MinimumBrush = STB.GetCellInt(Row, 2);
+      Brush.MaximumBrush = STB.GetCellInt(Row, 3);
+      Brush.TileNumber0 = STB.GetCellInt(Row, 4);
+      Brush.TileCount0 = STB.GetCellInt(Row, 5);
+      Brush.TileNumberF = STB.GetCellInt(Row, 6);
+      Brush.TileCountF = STB.GetCellInt(Row, 7);
+      Brush.TileNumber = STB.GetCellInt(Row, 8);
+      Brush.TileCount = STB.GetCellInt(Row, 9);
+      Brush.Direction = STB.GetCellInt(Row, 10);
     }
 
     // Next row after brushes: max brush count for chains
@@ -276,7 +356,7 @@ struct FRoseTileSet {
       return true;
     }
 
-    int32 MaxBrushCount = FCString::Atoi(*STB.GetCell(ChainRow, 2));
+    int32 MaxBrushCount = STB.GetCellInt(ChainRow, 2);
     if (MaxBrushCount > 0) {
       // Initialize chains matrix
       Chains.SetNum(MaxBrushCount);
@@ -287,7 +367,7 @@ struct FRoseTileSet {
         if (DataRow < STB.GetRowCount()) {
           for (int32 j = 0; j < MaxBrushCount && j + 2 < STB.GetColumnCount();
                ++j) {
-            Chains[i][j] = FCString::Atoi(*STB.GetCell(DataRow, j + 2));
+            Chains[i][j] = STB.GetCellInt(DataRow, j + 2);
           }
         }
       }
@@ -649,6 +729,16 @@ struct FRoseZSC {
     float Blue;
   };
 
+  // Shape bits of FObjectPart::CollisionMode; higher bits are flags
+  enum ECollisionShape : int16 {
+    COLLISION_NONE = 0,
+    COLLISION_SPHERE = 1,
+    COLLISION_AABB = 2,
+    COLLISION_OBB = 3,
+    COLLISION_POLYGON = 4,
+    COLLISION_SHAPE_MASK = 7,
+  };
+
   struct FObjectPart {
     int16 MeshIndex;
     int16 MaterialIndex;
@@ -658,6 +748,7 @@ struct FRoseZSC {
     FQuat4f AxisRotation = FQuat4f::Identity;
     int16 ParentID = -1;
     int16 CollisionMode = 0;
+    bool bHasCollisionMode = false; // Property 29 was present
     int16 BoneIndex = 0;
     int16 DummyIndex = 0;
     FString AnimPath; // ConstantAnimation (ZSC property 30)
@@ -673,11 +764,15 @@ struct FRoseZSC {
   TArray<FMaterialEntry> Materials;
   TArray<FString> Effects;
   TArray<FObjectEntry> Objects;
+  FString Name; // Base file name, e.g. LIST_DECO_JPT
+  FString Path; // File the list was loaded from
 
   bool Load(const FString &FilePath) {
     TArray<uint8> Data;
     if (!FFileHelper::LoadFileToArray(Data, *FilePath))
       return false;
+    Name = FPaths::GetBaseFilename(FilePath);
+    Path = FilePath;
 
     FMemoryReader MemReader(Data, true);
     FRoseArchive Ar(MemReader);
@@ -829,6 +924,7 @@ struct FRoseZSC {
             break;
           case 29: // Collision
             Ar << Part.CollisionMode;
+            Part.bHasCollisionMode = true;
             break;
           case 30: // ConstantAnimation (string path to ZMO)
           {
@@ -930,7 +1026,9 @@ struct FRoseZMS {
   TArray<FVertex> Vertices;
 
   int32 FaceCount = 0;
-  TArray<uint16> Indices;
+  // 32-bit in memory so optimized or merged data can pass 65535 vertices;
+  // the file itself stores 16-bit indices
+  TArray<uint32> Indices;
 
   int32 MaterialID = 0;
 
@@ -975,7 +1073,7 @@ struct FRoseZMS {
            TEXT("ZMS Load: Flags=%d, Bones=%d, Verts=%d"), Format, BoneCount,
            VertCount);
 
-    if (VertCount > 65535 || VertCount < 0) {
+    if (VertCount > MAX_uint16 || VertCount < 0) {
       UE_LOG(LogRoseImporter, Error, TEXT("Suspicious VertCount %d. Aborting."),
              VertCount);
       return false;
@@ -1061,8 +1159,11 @@ struct FRoseZMS {
     FaceCount = FC;
     UE_LOG(LogRoseImporter, Display, TEXT("ZMS Faces: %d"), FaceCount);
 
-    Indices.SetNum(FaceCount * 3);
-    Ar.Serialize(Indices.GetData(), Indices.Num() * sizeof(uint16));
+    TArray<uint16> RawIndices;
+    RawIndices.SetNumUninitialized(FaceCount * 3);
+    Ar.Serialize(RawIndices.GetData(), RawIndices.Num() * sizeof(uint16));
+    Indices.Reset(RawIndices.Num());
+    Indices.Append(RawIndices);
 
     uint16 MatID = 0;
     Ar << MatID;
@@ -1289,3 +1390,91 @@ struct FRoseZMO {
     return true;
   }
 };
+
+/**
+ * Root-bone keys of a ZMO, built once and shared read-only by every object
+ * that plays it. Channels the clip does not animate are left empty.
+ */
+struct FRoseAnimClip {
+  int32 FPS = 0;
+  int32 FrameCount = 0;
+  TArray<FVector3f> PosKeys;
+  TArray<FQuat4f> RotKeys;
+  TArray<FVector3f> ScaleKeys;
+
+  FRoseAnimClip() = default;
+  explicit FRoseAnimClip(const FRoseZMO &ZMO)
+      : FPS(ZMO.FPS), FrameCount(ZMO.FrameCount) {
+    for (const FRoseAnimChannel &Chan : ZMO.Channels) {
+      // Child bones and dummies must not drive the whole mesh
+      if (Chan.BoneID != 0)
+        continue;
+
+      if (Chan.Type == 2 && Chan.PosKeys.Num() > 0) {
+        PosKeys = Chan.PosKeys;
+      } else if (Chan.Type == 4 && Chan.RotKeys.Num() > 0) {
+        RotKeys = Chan.RotKeys;
+      } else if (Chan.Type == 1024 && Chan.ScaleKeys.Num() > 0) {
+        ScaleKeys = Chan.ScaleKeys;
+      }
+    }
+  }
+
+  bool IsPlayable() const { return FrameCount > 0 && FPS > 0; }
+  float GetDuration() const {
+    return IsPlayable() ? (float)FrameCount / (float)FPS : 0.0f;
+  }
+
+  // Samples the clip at Time seconds, looping. Missing channels stay identity
+  FTransform Evaluate(float Time) const {
+    FTransform Local = FTransform::Identity;
+    if (!IsPlayable())
+      return Local;
+
+    const float FrameF = FMath::Fmod(Time, GetDuration()) * (float)FPS;
+    const int32 Frame0 = FMath::Max(0, FMath::FloorToInt(FrameF));
+    const float Alpha = FrameF - (float)Frame0;
+
+    if (PosKeys.Num() > 0) {
+      const int32 F0 = FMath::Min(Frame0, PosKeys.Num() - 1);
+      const int32 F1 = FMath::Min(F0 + 1, PosKeys.Num() - 1);
+      Local.SetLocation((FVector)FMath::Lerp(PosKeys[F0], PosKeys[F1], Alpha));
+    }
+    if (RotKeys.Num() > 0) {
+      const int32 F0 = FMath::Min(Frame0, RotKeys.Num() - 1);
+      const int32 F1 = FMath::Min(F0 + 1, RotKeys.Num() - 1);
+      Local.SetRotation(
+          (FQuat)FQuat4f::Slerp(RotKeys[F0], RotKeys[F1], Alpha));
+    }
+    if (ScaleKeys.Num() > 0) {
+      const int32 F0 = FMath::Min(Frame0, ScaleKeys.Num() - 1);
+      const int32 F1 = FMath::Min(F0 + 1, ScaleKeys.Num() - 1);
+      Local.SetScale3D(
+          (FVector)FMath::Lerp(ScaleKeys[F0], ScaleKeys[F1], Alpha));
+    }
+    return Local;
+  }
+
+  // Lays the keys out as a FrameCount x 3 image for vertex animation:
+  // row 0 position, row 1 rotation (XYZW), row 2 scale. Channels the clip
+  // does not animate are written as identity.
+  void Bake(TArray<FLinearColor> &OutPixels) const {
+    const int32 Width = FMath::Max(1, FrameCount);
+    OutPixels.SetNumUninitialized(Width * 3);
+    for (int32 f = 0; f < Width; ++f) {
+      const FVector3f P =
+          PosKeys.Num() > 0 ? PosKeys[FMath::Min(f, PosKeys.Num() - 1)]
+                            : FVector3f::ZeroVector;
+      const FQuat4f R =
+          RotKeys.Num() > 0
+              ? RotKeys[FMath::Min(f, RotKeys.Num() - 1)].GetNormalized()
+              : FQuat4f::Identity;
+      const FVector3f S =
+          ScaleKeys.Num() > 0 ? ScaleKeys[FMath::Min(f, ScaleKeys.Num() - 1)]
+                              : FVector3f::OneVector;
+      OutPixels[f] = FLinearColor(P.X, P.Y, P.Z, 1.0f);
+      OutPixels[Width + f] = FLinearColor(R.X, R.Y, R.Z, R.W);
+      OutPixels[Width * 2 + f] = FLinearColor(S.X, S.Y, S.Z, 1.0f);
+    }
+  }
+};
@@ -0,0 +1,300 @@
+#include "RoseImportSession.h"
+#include "BonsoirUnrealLog.h"
+#include "Editor.h"
+#include "Engine/Texture2D.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "RoseImportSettings.h"
+
+static FAutoConsoleCommand GRoseResetImportSession(
+    TEXT("Rose.ResetImportSession"),
+    TEXT("Clears the ROSE importer's session caches (STBs, clips, textures, "
+         "materials, skeletons)"),
+    FConsoleCommandDelegate::CreateLambda([]() {
+      if (URoseImportSession *Session = URoseImportSession::Get()) {
+        Session->LogStats();
+        Session->Reset();
+      }
+    }));
+
+URoseImportSession *URoseImportSession::Get() {
+  return GEditor ? GEditor->GetEditorSubsystem<URoseImportSession>() : nullptr;
+}
+
+void URoseImportSession::Initialize(FSubsystemCollectionBase &Collection) {
+  Super::Initialize(Collection);
+  SettingsChangedHandle =
+      GetMutableDefault<URoseImportSettings>()->OnSettingChanged().AddUObject(
+          this, &URoseImportSession::OnSettingsChanged);
+}
+
+void URoseImportSession::Deinitialize() {
+  GetMutableDefault<URoseImportSettings>()->OnSettingChanged().Remove(
+      SettingsChangedHandle);
+  Reset();
+  Super::Deinitialize();
+}
+
+void URoseImportSession::BeginImport(const FString &InRootPath) {
+  FString Root = InRootPath;
+  FPaths::NormalizeDirectoryName(Root);
+  if (!RootPath.IsEmpty() && !RootPath.Equals(Root, ESearchCase::IgnoreCase)) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Session] ROSE root changed (%s -> %s), clearing caches"),
+           *RootPath, *Root);
+    Reset();
+  }
+  RootPath = Root;
+  ImportCount++;
+
+  // Files may have been added since: retry the lookups that failed
+  for (auto It = TexturePaths.CreateIterator(); It; ++It) {
+    if (It->Value.IsEmpty()) {
+      It.RemoveCurrent();
+    }
+  }
+}
+
+void URoseImportSession::Reset() {
+  STBs.Empty();
+  AnimClips.Empty();
+  Textures.Empty();
+  TexturePaths.Empty();
+  SkeletonBindings.Empty();
+  ResetMaterialState();
+  RootPath.Empty();
+  ImportCount = 0;
+  STBStats = ClipStats = TextureStats = TexturePathStats =
+      MasterMaterialStats = MaterialStats = SkeletonStats =
+          FRoseSessionCacheStats();
+}
+
+void URoseImportSession::ResetMaterialState() {
+  MasterMaterials.Empty();
+  MaterialInstances.Empty();
+  MaterialSourceTimes.Empty();
+}
+
+void URoseImportSession::OnSettingsChanged(UObject *Settings,
+                                           FPropertyChangedEvent &Event) {
+  // Material instances are built from the settings; look at them again
+  UE_LOG(LogRoseImporter, Log,
+         TEXT("[Session] Import settings changed, material state reset"));
+  ResetMaterialState();
+}
+
+FString URoseImportSession::MakeKey(const FString &Path) {
+  FString Key = Path;
+  FPaths::NormalizeFilename(Key);
+  Key.ToLowerInline();
+  return Key;
+}
+
+TSharedPtr<const FRoseSTB> URoseImportSession::GetSTB(const FString &FilePath) {
+  const FString Key = MakeKey(FilePath);
+  const FDateTime SourceTime = IFileManager::Get().GetTimeStamp(*FilePath);
+  if (FCachedSTB *Cached = STBs.Find(Key)) {
+    if (Cached->SourceTime == SourceTime) {
+      STBStats.Hits++;
+      return Cached->STB;
+    }
+    STBStats.Invalidated++;
+    STBs.Remove(Key);
+  }
+
+  STBStats.Misses++;
+  TSharedPtr<FRoseSTB> STB = MakeShared<FRoseSTB>();
+  if (!STB->Load(FilePath))
+    return nullptr;
+  STBs.Add(Key, FCachedSTB{STB, SourceTime});
+  return STB;
+}
+
+TSharedPtr<const FRoseAnimClip>
+URoseImportSession::GetAnimClip(const FString &FilePath) {
+  const FString Key = MakeKey(FilePath);
+  const FDateTime SourceTime = IFileManager::Get().GetTimeStamp(*FilePath);
+  if (FCachedClip *Cached = AnimClips.Find(Key)) {
+    if (Cached->SourceTime == SourceTime) {
+      ClipStats.Hits++;
+      return Cached->Clip;
+    }
+    ClipStats.Invalidated++;
+  }
+
+  ClipStats.Misses++;
+  TSharedPtr<const FRoseAnimClip> Clip;
+  FRoseZMO ZMO;
+  if (!ZMO.Load(FilePath)) {
+    UE_LOG(LogRoseImporter, Warning,
+           TEXT("[Anim] Failed to load ZMO: "
+                "%s - spawning static"),
+           *FilePath);
+  } else {
+    TSharedPtr<FRoseAnimClip> NewClip = MakeShared<FRoseAnimClip>(ZMO);
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Anim] Loaded clip: %s (%d frames @ %d FPS, Pos:%d Rot:%d "
+                "Scl:%d)"),
+           *FilePath, NewClip->FrameCount, NewClip->FPS,
+           NewClip->PosKeys.Num(), NewClip->RotKeys.Num(),
+           NewClip->ScaleKeys.Num());
+    if (!NewClip->IsPlayable()) {
+      UE_LOG(LogRoseImporter, Warning,
+             TEXT("[Anim] ZMO has no frames "
+                  "or invalid FPS: %s"),
+             *FilePath);
+    }
+    Clip = NewClip;
+  }
+
+  // Failed loads are cached too, until the file changes
+  AnimClips.Add(Key, FCachedClip{Clip, SourceTime});
+  return Clip;
+}
+
+UTexture2D *URoseImportSession::FindTexture(const FString &RelPath) {
+  const FString Key = MakeKey(RelPath);
+  if (TWeakObjectPtr<UTexture2D> *Cached = Textures.Find(Key)) {
+    if (UTexture2D *Texture = Cached->Get()) {
+      TextureStats.Hits++;
+      return Texture;
+    }
+    TextureStats.Invalidated++;
+    Textures.Remove(Key);
+  }
+  TextureStats.Misses++;
+  return nullptr;
+}
+
+void URoseImportSession::AddTexture(const FString &RelPath,
+                                    UTexture2D *Texture) {
+  Textures.Add(MakeKey(RelPath), Texture);
+}
+
+bool URoseImportSession::FindTexturePath(const FString &RelPath,
+                                         FString &OutPath) {
+  const FString Key = MakeKey(RelPath);
+  if (const FString *Cached = TexturePaths.Find(Key)) {
+    // A file that moved away is searched for again
+    if (Cached->IsEmpty() || FPaths::FileExists(*Cached)) {
+      TexturePathStats.Hits++;
+      OutPath = *Cached;
+      return true;
+    }
+    TexturePathStats.Invalidated++;
+    TexturePaths.Remove(Key);
+  }
+  TexturePathStats.Misses++;
+  return false;
+}
+
+void URoseImportSession::AddTexturePath(const FString &RelPath,
+                                        const FString &Path) {
+  TexturePaths.Add(MakeKey(RelPath), Path);
+}
+
+UMaterial *URoseImportSession::FindMasterMaterial(const FString &Name) {
+  if (TWeakObjectPtr<UMaterial> *Cached = MasterMaterials.Find(Name)) {
+    if (UMaterial *Material = Cached->Get()) {
+      MasterMaterialStats.Hits++;
+      return Material;
+    }
+    MasterMaterialStats.Invalidated++;
+    MasterMaterials.Remove(Name);
+  }
+  MasterMaterialStats.Misses++;
+  return nullptr;
+}
+
+void URoseImportSession::AddMasterMaterial(const FString &Name,
+                                           UMaterial *Material) {
+  MasterMaterials.Add(Name, Material);
+}
+
+UMaterialInstanceConstant *
+URoseImportSession::FindMaterialInstance(const FString &PackageName) {
+  if (TWeakObjectPtr<UMaterialInstanceConstant> *Cached =
+          MaterialInstances.Find(PackageName)) {
+    if (UMaterialInstanceConstant *MIC = Cached->Get()) {
+      MaterialStats.Hits++;
+      return MIC;
+    }
+    MaterialStats.Invalidated++;
+    MaterialInstances.Remove(PackageName);
+  }
+  MaterialStats.Misses++;
+  return nullptr;
+}
+
+void URoseImportSession::AddMaterialInstance(const FString &PackageName,
+                                             UMaterialInstanceConstant *MIC) {
+  MaterialInstances.Add(PackageName, MIC);
+}
+
+void URoseImportSession::CheckMaterialSources(
+    TConstArrayView<FString> ZSCPaths) {
+  bool bChanged = false;
+  for (const FString &Path : ZSCPaths) {
+    if (Path.IsEmpty())
+      continue;
+    const FDateTime SourceTime = IFileManager::Get().GetTimeStamp(*Path);
+    const FDateTime *Known = MaterialSourceTimes.Find(MakeKey(Path));
+    bChanged |= Known && *Known != SourceTime;
+  }
+  if (bChanged) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Session] ZSC changed on disk, material state reset"));
+    MaterialStats.Invalidated += MaterialInstances.Num();
+    ResetMaterialState();
+  }
+  for (const FString &Path : ZSCPaths) {
+    if (!Path.IsEmpty()) {
+      MaterialSourceTimes.Add(MakeKey(Path),
+                              IFileManager::Get().GetTimeStamp(*Path));
+    }
+  }
+}
+
+TSharedPtr<const FRoseSkeletonBinding>
+URoseImportSession::FindSkeletonBinding(const FString &ZMDPath) {
+  const FString Key = MakeKey(ZMDPath);
+  if (const TSharedPtr<const FRoseSkeletonBinding> *Cached =
+          SkeletonBindings.Find(Key)) {
+    if ((*Cached)->SourceTime == IFileManager::Get().GetTimeStamp(*ZMDPath)) {
+      SkeletonStats.Hits++;
+      return *Cached;
+    }
+    SkeletonStats.Invalidated++;
+    SkeletonBindings.Remove(Key);
+  }
+  SkeletonStats.Misses++;
+  return nullptr;
+}
+
+void URoseImportSession::AddSkeletonBinding(
+    const FString &ZMDPath, TSharedPtr<const FRoseSkeletonBinding> Binding) {
+  SkeletonBindings.Add(MakeKey(ZMDPath), MoveTemp(Binding));
+}
+
+void URoseImportSession::LogStats() const {
+  UE_LOG(LogRoseImporter, Log, TEXT("[Session] %d imports since last reset"),
+         ImportCount);
+  auto LogCache = [](const TCHAR *Name, const FRoseSessionCacheStats &Stats,
+                     int32 NumEntries) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Session]   %s: %d entries, %d hits, %d misses, %d "
+                "invalidated"),
+           Name, NumEntries, Stats.Hits, Stats.Misses, Stats.Invalidated);
+  };
+  LogCache(TEXT("STBs"), STBStats, STBs.Num());
+  LogCache(TEXT("ZMO clips"), ClipStats, AnimClips.Num());
+  LogCache(TEXT("Textures"), TextureStats, Textures.Num());
+  LogCache(TEXT("Texture paths"), TexturePathStats, TexturePaths.Num());
+  LogCache(TEXT("Master materials"), MasterMaterialStats,
+           MasterMaterials.Num());
+  LogCache(TEXT("Material instances"), MaterialStats,
+           MaterialInstances.Num());
+  LogCache(TEXT("Skeletons"), SkeletonStats, SkeletonBindings.Num());
+}
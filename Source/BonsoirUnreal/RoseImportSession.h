@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "RoseFormats.h"
+#include "RoseImportSession.generated.h"
+
+class UMaterial;
+class UMaterialInstanceConstant;
+class UTexture2D;
+
+/**
+ * Bone remap and rigid-binding transforms of an imported ZMD skeleton,
+ * valid while the ZMD file keeps its timestamp.
+ */
+struct FRoseSkeletonBinding {
+  // ZMD bone/dummy index -> reference skeleton index
+  TArray<int32> Remap;
+  // Bone world transforms in Unreal LHS space (face/hair rigid binding)
+  TMap<FName, FTransform> BoneWorldTransformsLHS;
+  FDateTime SourceTime;
+};
+
+/**
+ * Lookups served by one session cache since the last reset.
+ */
+struct FRoseSessionCacheStats {
+  int32 Hits = 0;
+  int32 Misses = 0;
+  int32 Invalidated = 0;
+};
+
+/**
+ * Import state that outlives a single URoseImporter. Each toolbar click or
+ * factory import creates a new importer; parsed STBs and ZMO clips, texture
+ * lookups, verified master materials, processed material instances and
+ * skeleton remaps are kept here for the whole editor session.
+ *
+ * Invalidation rules:
+ * - STBs, clips and skeleton bindings keep their source file timestamp and
+ *   are loaded again when the file changes on disk;
+ * - a different ROSE root resets everything;
+ * - an edit to URoseImportSettings, or a ZSC file changing on disk, resets
+ *   the material state;
+ * - asset entries are weak and drop out once the asset is deleted;
+ * - not-found texture lookups only live for one import;
+ * - Rose.ResetImportSession clears everything.
+ */
+UCLASS()
+class BONSOIRUNREAL_API URoseImportSession : public UEditorSubsystem {
+  GENERATED_BODY()
+
+public:
+  // The editor's session, or null outside the editor
+  static URoseImportSession *Get();
+
+  virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+  virtual void Deinitialize() override;
+
+  // Called by every import once its ROSE root is known
+  void BeginImport(const FString &RootPath);
+
+  // Drops every cache
+  void Reset();
+
+  // Parsed STB, loaded again when the file changed (null if it fails)
+  TSharedPtr<const FRoseSTB> GetSTB(const FString &FilePath);
+
+  // Shared ZMO clip, loaded again when the file changed (null on error)
+  TSharedPtr<const FRoseAnimClip> GetAnimClip(const FString &FilePath);
+
+  // Texture lookups: ROSE relative path -> imported asset and source file.
+  // An empty resolved path records a file that was not found.
+  UTexture2D *FindTexture(const FString &RelPath);
+  void AddTexture(const FString &RelPath, UTexture2D *Texture);
+  bool FindTexturePath(const FString &RelPath, FString &OutPath);
+  void AddTexturePath(const FString &RelPath, const FString &Path);
+
+  // Master materials already checked (and built if needed)
+  UMaterial *FindMasterMaterial(const FString &Name);
+  void AddMasterMaterial(const FString &Name, UMaterial *Material);
+
+  // Material instances updated and saved this session, by package name
+  UMaterialInstanceConstant *FindMaterialInstance(const FString &PackageName);
+  void AddMaterialInstance(const FString &PackageName,
+                           UMaterialInstanceConstant *MIC);
+
+  // Resets the material state when one of the ZSC files changed since the
+  // last import that used it
+  void CheckMaterialSources(TConstArrayView<FString> ZSCPaths);
+
+  // Skeleton binding for a ZMD, null when it is missing or out of date
+  TSharedPtr<const FRoseSkeletonBinding>
+  FindSkeletonBinding(const FString &ZMDPath);
+  void AddSkeletonBinding(const FString &ZMDPath,
+                          TSharedPtr<const FRoseSkeletonBinding> Binding);
+
+  // Writes the cache statistics to the log
+  void LogStats() const;
+
+private:
+  void ResetMaterialState();
+  void OnSettingsChanged(UObject *Settings,
+                         struct FPropertyChangedEvent &Event);
+
+  static FString MakeKey(const FString &Path);
+
+  FString RootPath;
+  int32 ImportCount = 0;
+
+  struct FCachedSTB {
+    TSharedPtr<const FRoseSTB> STB;
+    FDateTime SourceTime;
+  };
+  TMap<FString, FCachedSTB> STBs;
+
+  struct FCachedClip {
+    TSharedPtr<const FRoseAnimClip> Clip;
+    FDateTime SourceTime;
+  };
+  TMap<FString, FCachedClip> AnimClips;
+
+  TMap<FString, TWeakObjectPtr<UTexture2D>> Textures;
+  TMap<FString, FString> TexturePaths;
+
+  TMap<FString, TWeakObjectPtr<UMaterial>> MasterMaterials;
+  TMap<FString, TWeakObjectPtr<UMaterialInstanceConstant>> MaterialInstances;
+  TMap<FString, FDateTime> MaterialSourceTimes;
+
+  TMap<FString, TSharedPtr<const FRoseSkeletonBinding>> SkeletonBindings;
+
+  FDelegateHandle SettingsChangedHandle;
+
+  FRoseSessionCacheStats STBStats;
+  FRoseSessionCacheStats ClipStats;
+  FRoseSessionCacheStats TextureStats;
+  FRoseSessionCacheStats TexturePathStats;
+  FRoseSessionCacheStats MasterMaterialStats;
+  FRoseSessionCacheStats MaterialStats;
+  FRoseSessionCacheStats SkeletonStats;
+};
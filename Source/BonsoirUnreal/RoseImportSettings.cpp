@@ -0,0 +1,92 @@
+#include "RoseImportSettings.h"
+
+bool FRoseCullDistanceRule::Matches(ERoseObjectSource InSource,
+                                    const FString &MeshPath,
+                                    float ObjectSize) const {
+  if (Source != ERoseObjectSource::Any && Source != InSource)
+    return false;
+  if (!NameContains.IsEmpty() &&
+      !MeshPath.Contains(NameContains, ESearchCase::IgnoreCase))
+    return false;
+  if (MaxObjectSize > 0.0f && ObjectSize > MaxObjectSize)
+    return false;
+  return true;
+}
+
+FString FRoseCullDistanceRule::Describe() const {
+  const UEnum *SourceEnum = StaticEnum<ERoseObjectSource>();
+  FString Desc = SourceEnum->GetNameStringByValue((int64)Source);
+  if (!NameContains.IsEmpty()) {
+    Desc += FString::Printf(TEXT(" '%s'"), *NameContains);
+  }
+  if (MaxObjectSize > 0.0f) {
+    Desc += FString::Printf(TEXT(" <= %.0fcm"), MaxObjectSize);
+  }
+  return Desc + FString::Printf(TEXT(" -> %d-%dcm"), StartCullDistance,
+                                EndCullDistance);
+}
+
+URoseImportSettings::URoseImportSettings() {
+  // Defaults: ground cover goes first, then small props; buildings and
+  // anything unmatched are never culled
+  FRoseCullDistanceRule Grass;
+  Grass.Source = ERoseObjectSource::Deco;
+  Grass.NameContains = TEXT("grass");
+  Grass.StartCullDistance = 4000;
+  Grass.EndCullDistance = 6000;
+  CullDistanceRules.Add(Grass);
+
+  FRoseCullDistanceRule SmallDeco;
+  SmallDeco.Source = ERoseObjectSource::Deco;
+  SmallDeco.MaxObjectSize = 300.0f;
+  SmallDeco.StartCullDistance = 8000;
+  SmallDeco.EndCullDistance = 12000;
+  CullDistanceRules.Add(SmallDeco);
+
+  FRoseCullDistanceRule Deco;
+  Deco.Source = ERoseObjectSource::Deco;
+  Deco.MaxObjectSize = 1500.0f;
+  Deco.StartCullDistance = 20000;
+  Deco.EndCullDistance = 30000;
+  CullDistanceRules.Add(Deco);
+
+  auto Level = [](float PercentTriangles, float ScreenSize) {
+    FRoseLODLevel L;
+    L.PercentTriangles = PercentTriangles;
+    L.ScreenSize = ScreenSize;
+    return L;
+  };
+
+  // Buildings fill the screen for longer, so they keep detail further out
+  FRoseLODRule Buildings;
+  Buildings.Source = ERoseObjectSource::Cnst;
+  Buildings.MinTriangles = 2000;
+  Buildings.Levels = {Level(50.0f, 0.3f), Level(25.0f, 0.12f),
+                      Level(10.0f, 0.04f)};
+  LODRules.Add(Buildings);
+
+  FRoseLODRule Props;
+  Props.MinTriangles = 1000;
+  Props.Levels = {Level(50.0f, 0.25f), Level(20.0f, 0.08f)};
+  LODRules.Add(Props);
+}
+
+const FRoseLODRule *
+URoseImportSettings::FindLODRule(ERoseObjectSource Source,
+                                 int32 NumTriangles) const {
+  for (const FRoseLODRule &Rule : LODRules) {
+    if (Rule.Matches(Source, NumTriangles) && Rule.Levels.Num() > 0)
+      return &Rule;
+  }
+  return nullptr;
+}
+
+int32 URoseImportSettings::FindCullDistanceRule(ERoseObjectSource Source,
+                                                const FString &MeshPath,
+                                                float ObjectSize) const {
+  for (int32 i = 0; i < CullDistanceRules.Num(); ++i) {
+    if (CullDistanceRules[i].Matches(Source, MeshPath, ObjectSize))
+      return i;
+  }
+  return INDEX_NONE;
+}
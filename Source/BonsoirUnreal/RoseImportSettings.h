@@ -0,0 +1,271 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "RoseImportSettings.generated.h"
+
+class UHLODLayer;
+
+/**
+ * How zone object HISMs are split spatially.
+ */
+UENUM()
+enum class ERoseHISMPartition : uint8 {
+  // One component per HISM key for the whole zone
+  None,
+  // One component per HISM key and map tile (FRoseMapObject::MapPosition)
+  Tile,
+  // One component per HISM key and square grid cell of PartitionCellSize
+  Cell,
+};
+
+/**
+ * Which ZSC a zone object was placed from.
+ */
+UENUM()
+enum class ERoseObjectSource : uint8 {
+  Any,
+  Deco, // Decorations (trees, grass, props)
+  Cnst, // Constructions (buildings)
+  Anim, // Animated objects (flags, windmills)
+};
+
+/**
+ * Where new meshes get their lightmap UV channel from.
+ */
+UENUM()
+enum class ERoseLightmapUVs : uint8 {
+  // No lightmap channel (Lumen or dynamic lighting only); skips UV packing
+  None,
+  // Use the ZMS UV2 channel when it is a valid unwrap, otherwise generate
+  ReuseOrGenerate,
+  // Always pack a new channel from the texture UVs
+  Generate,
+};
+
+/**
+ * Cull distances for zone HISMs whose objects match every set condition.
+ */
+USTRUCT()
+struct FRoseCullDistanceRule {
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, Category = "Culling")
+  ERoseObjectSource Source = ERoseObjectSource::Any;
+
+  // Case-insensitive substring of the mesh path; empty matches every mesh
+  UPROPERTY(EditAnywhere, Category = "Culling")
+  FString NameContains;
+
+  // Largest edge of the ZSC object bounding box; 0 matches every size
+  UPROPERTY(EditAnywhere, Category = "Culling",
+            meta = (ClampMin = "0.0", Units = "cm"))
+  float MaxObjectSize = 0.0f;
+
+  // Instances fade out between these distances; 0 never culls
+  UPROPERTY(EditAnywhere, Category = "Culling",
+            meta = (ClampMin = "0", Units = "cm"))
+  int32 StartCullDistance = 0;
+
+  UPROPERTY(EditAnywhere, Category = "Culling",
+            meta = (ClampMin = "0", Units = "cm"))
+  int32 EndCullDistance = 0;
+
+  bool Matches(ERoseObjectSource InSource, const FString &MeshPath,
+               float ObjectSize) const;
+  FString Describe() const;
+};
+
+/**
+ * One generated LOD: how much of LOD0 it keeps and when it kicks in.
+ */
+USTRUCT()
+struct FRoseLODLevel {
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, Category = "LOD",
+            meta = (ClampMin = "1.0", ClampMax = "100.0", Units = "Percent"))
+  float PercentTriangles = 50.0f;
+
+  // Screen size below which this LOD is used
+  UPROPERTY(EditAnywhere, Category = "LOD",
+            meta = (ClampMin = "0.0", ClampMax = "1.0"))
+  float ScreenSize = 0.3f;
+};
+
+/**
+ * LOD chain for newly imported meshes of a category and size.
+ */
+USTRUCT()
+struct FRoseLODRule {
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, Category = "LOD")
+  ERoseObjectSource Source = ERoseObjectSource::Any;
+
+  // Meshes with fewer LOD0 triangles keep a single LOD
+  UPROPERTY(EditAnywhere, Category = "LOD", meta = (ClampMin = "0"))
+  int32 MinTriangles = 1000;
+
+  UPROPERTY(EditAnywhere, Category = "LOD")
+  TArray<FRoseLODLevel> Levels;
+
+  bool Matches(ERoseObjectSource InSource, int32 NumTriangles) const {
+    return (Source == ERoseObjectSource::Any || Source == InSource) &&
+           NumTriangles >= MinTriangles;
+  }
+};
+
+/**
+ * Project-wide options for the ROSE zone importer.
+ * Shown under Project Settings > Plugins > Rose Importer.
+ */
+UCLASS(config = Editor, defaultconfig, meta = (DisplayName = "Rose Importer"))
+class BONSOIRUNREAL_API URoseImportSettings : public UDeveloperSettings {
+  GENERATED_BODY()
+
+public:
+  URoseImportSettings();
+
+  virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+
+  // Splits zone HISMs so each component has tight bounds and can be culled
+  // or streamed on its own
+  UPROPERTY(config, EditAnywhere, Category = "Instancing")
+  ERoseHISMPartition HISMPartition = ERoseHISMPartition::None;
+
+  // Grid cell edge length in cm (one ROSE map tile is 16000 cm)
+  UPROPERTY(config, EditAnywhere, Category = "Instancing",
+            meta = (ClampMin = "1000.0", Units = "cm",
+                    EditCondition =
+                        "HISMPartition == ERoseHISMPartition::Cell"))
+  float PartitionCellSize = 16000.0f;
+
+  // Put each partition cell on its own actor so World Partition can stream
+  // the cells independently
+  UPROPERTY(config, EditAnywhere, Category = "Instancing",
+            meta = (EditCondition =
+                        "HISMPartition != ERoseHISMPartition::None"))
+  bool bSpawnPartitionActors = false;
+
+  // Insert instances in Z-order (Morton) of their XY position instead of IFO
+  // file order, which gives HISM clusters tighter bounds
+  UPROPERTY(config, EditAnywhere, Category = "Instancing")
+  bool bSortInstances = true;
+
+  // Also build each HISM's cluster tree from the file order and from the
+  // sorted order, and log build times and how many instances survive
+  // cluster culling. Slow; only for measuring bSortInstances
+  UPROPERTY(config, EditAnywhere, Category = "Instancing",
+            meta = (EditCondition = "bSortInstances"))
+  bool bBenchmarkInstanceSort = false;
+
+  // Checked in order, the first matching rule sets the HISM cull distances
+  UPROPERTY(config, EditAnywhere, Category = "Culling")
+  TArray<FRoseCullDistanceRule> CullDistanceRules;
+
+  // Index of the first rule matching the object, or INDEX_NONE
+  int32 FindCullDistanceRule(ERoseObjectSource Source, const FString &MeshPath,
+                             float ObjectSize) const;
+
+  // Give each partition cell a merged, texture-baked proxy for far-field
+  // rendering. Needs bSpawnPartitionActors. In World Partition levels the
+  // cell actors get HLODLayer instead and Build > Build HLODs makes the
+  // proxies
+  UPROPERTY(config, EditAnywhere, Category = "HLOD")
+  bool bGenerateHLODs = false;
+
+  // World Partition layer for the cell actors; a simplified-mesh layer
+  // under /Game/Rose/Imported/HLOD is created when empty
+  UPROPERTY(config, EditAnywhere, Category = "HLOD",
+            meta = (EditCondition = "bGenerateHLODs"))
+  TSoftObjectPtr<UHLODLayer> HLODLayer;
+
+  // Levels without World Partition: distance at which a cell switches to
+  // its proxy. HISMs culled before this distance are left out of it
+  UPROPERTY(config, EditAnywhere, Category = "HLOD",
+            meta = (ClampMin = "0.0", Units = "cm",
+                    EditCondition = "bGenerateHLODs"))
+  float HLODDrawDistance = 30000.0f;
+
+  // Bake static multi-part ZSC objects into one mesh with a section per
+  // material, so each placement is a single instance. Objects whose parts
+  // mix opaque, masked and translucent materials stay per part
+  UPROPERTY(config, EditAnywhere, Category = "Meshes")
+  bool bMergeObjectPrefabs = false;
+
+  // Weld duplicate ZMS vertices and reorder triangles and vertices for the
+  // GPU vertex cache before building new meshes
+  UPROPERTY(config, EditAnywhere, Category = "Meshes")
+  bool bOptimizeMeshes = true;
+
+  // Vertices closer than this, with matching normal, UVs and color, are
+  // merged. 0 only merges exact duplicates
+  UPROPERTY(config, EditAnywhere, Category = "Meshes",
+            meta = (ClampMin = "0.0", Units = "cm",
+                    EditCondition = "bOptimizeMeshes"))
+  float MeshWeldThreshold = 0.01f;
+
+  // Lightmap UV generation is one of the slowest steps of a mesh build and
+  // is wasted when the project uses no static lighting
+  UPROPERTY(config, EditAnywhere, Category = "Meshes")
+  ERoseLightmapUVs LightmapUVs = ERoseLightmapUVs::ReuseOrGenerate;
+
+  // Checked in order when a mesh is first imported; the first matching rule
+  // adds its LOD chain
+  UPROPERTY(config, EditAnywhere, Category = "LOD")
+  TArray<FRoseLODRule> LODRules;
+
+  const FRoseLODRule *FindLODRule(ERoseObjectSource Source,
+                                  int32 NumTriangles) const;
+
+  // Build opaque construction meshes above NaniteMinTriangles as Nanite.
+  // Masked and translucent ZSC materials always stay on the classic path.
+  UPROPERTY(config, EditAnywhere, Category = "LOD")
+  bool bEnableNaniteForBuildings = false;
+
+  UPROPERTY(config, EditAnywhere, Category = "LOD",
+            meta = (ClampMin = "0",
+                    EditCondition = "bEnableNaniteForBuildings"))
+  int32 NaniteMinTriangles = 5000;
+
+  // Use the ZSC part collision mode (none/sphere/box/polygon) when present
+  UPROPERTY(config, EditAnywhere, Category = "Collision")
+  bool bUseZSCCollisionMode = true;
+
+  // Without a ZSC mode, meshes up to this size get a single box and larger
+  // ones a convex decomposition. Only a ZSC polygon mode keeps the triangle
+  // mesh as collision.
+  UPROPERTY(config, EditAnywhere, Category = "Collision",
+            meta = (ClampMin = "0.0", Units = "cm"))
+  float CollisionBoxMaxSize = 300.0f;
+
+  // Hull budget of decorations and animated objects
+  UPROPERTY(config, EditAnywhere, Category = "Collision",
+            meta = (ClampMin = "1", ClampMax = "64"))
+  int32 CollisionMaxHulls = 8;
+
+  // Hull budget of constructions (LIST_ZONE building ZSC): walls and
+  // houses need more hulls to keep doorways and courtyards open
+  UPROPERTY(config, EditAnywhere, Category = "Collision",
+            meta = (ClampMin = "1", ClampMax = "64"))
+  int32 CollisionMaxHullsConstruction = 32;
+
+  // Drive all animated zone objects from one manager component with
+  // instanced meshes, instead of one ticking actor per object
+  UPROPERTY(config, EditAnywhere, Category = "Animation")
+  bool bBatchAnimatedObjects = true;
+
+  // Bake root-bone animation of props into a texture played back through
+  // World Position Offset, so they stay in static HISMs with no CPU cost
+  // per frame. Takes precedence over bBatchAnimatedObjects.
+  UPROPERTY(config, EditAnywhere, Category = "Animation")
+  bool bBakeAnimatedObjectsToWPO = false;
+
+  // Re-importing a zone only rebuilds the tiles, partition cells and assets
+  // whose source files changed since the last import (tracked by content
+  // hash in the zone's MapInfo asset). Needs bSpawnPartitionActors; any
+  // change to the ZON, ZSC lists or these settings forces a full import.
+  UPROPERTY(config, EditAnywhere, Category = "Reimport")
+  bool bIncrementalReimport = true;
+};
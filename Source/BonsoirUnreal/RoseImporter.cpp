@@ -1,14 +1,20 @@
 #include "RoseImporter.h"
+#include "RoseMeshOptimizer.h"
+#include "Algo/StableSort.h"
 #include "AssetExportTask.h"
 #include "AssetImportTask.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetToolsModule.h"
+#include "Async/ParallelFor.h"
 #include "BonsoirUnrealLog.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "ContentBrowserModule.h"
+#include "ConvexDecompTool.h"
 #include "DrawDebugHelpers.h"
 #include "EditorFramework/AssetImportData.h"
+#include "Engine/LODActor.h"
+#include "Engine/MeshMerging.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/StaticMeshActor.h"
 #include "Engine/Texture2D.h"
@@ -26,6 +32,7 @@
 #include "IContentBrowserSingleton.h"
 #include "IImageWrapper.h"
 #include "IImageWrapperModule.h"
+#include "IMeshMergeUtilities.h"
 #include "Internationalization/Text.h"
 #include "Kismet/GameplayStatics.h"
 #include "Landscape.h"
@@ -36,34 +43,94 @@
 #include "Materials/MaterialExpressionConstant.h"
 #include "Materials/MaterialExpressionConstant3Vector.h" // Added for Fallback Layer
 
+#include "Materials/MaterialExpressionCustom.h"
 #include "Materials/MaterialExpressionFrac.h"
 #include "Materials/MaterialExpressionLandscapeLayerBlend.h"
 #include "Materials/MaterialExpressionLandscapeLayerCoords.h"
 #include "Materials/MaterialExpressionLinearInterpolate.h"
 #include "Materials/MaterialExpressionMultiply.h"
+#include "Materials/MaterialExpressionPerInstanceCustomData.h"
+#include "Materials/MaterialExpressionPreSkinnedPosition.h"
 #include "Materials/MaterialExpressionRotator.h"
 #include "Materials/MaterialExpressionScalarParameter.h"
+#include "Materials/MaterialExpressionTextureObjectParameter.h"
 #include "Materials/MaterialExpressionTextureSample.h"
 #include "Materials/MaterialExpressionTextureSampleParameter2D.h"
+#include "Materials/MaterialExpressionTime.h"
+#include "Materials/MaterialExpressionTransform.h"
 #include "Materials/MaterialExpressionVectorParameter.h"
 #include "Materials/MaterialExpressionVertexColor.h"
 #include "Materials/MaterialInstanceConstant.h"
 #include "MeshDescription.h"
+#include "MeshMergeModule.h"
+#include "Misc/ScopeExit.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Misc/SecureHash.h"
 #include "ObjectTools.h"
 #include "PackageTools.h"
 #include "PhysicsEngine/BodySetup.h"
+#include "RoseAnimManagerComponent.h"
 #include "RoseFormats.h"
+#include "RoseMapInfo.h"
 #include "StaticMeshAttributes.h"
+#include "StaticMeshCompiler.h"
 #include "StaticMeshDescription.h"
+#include "StaticMeshOperations.h"
 #include "UObject/Package.h"
 #include "UObject/SavePackage.h"
+#include "WorldPartition/HLOD/HLODLayer.h"
+
+// Bump when the manifest layout or what it tracks changes; the next import
+// of every zone is then a full one
+static constexpr int32 RoseZoneManifestVersion = 1;
+
+// Manifest key of a source file (the maps compare keys case-insensitively)
+static FString MakeRoseSourceKey(const FString &Path) {
+  FString Key = Path;
+  FPaths::NormalizeFilename(Key);
+  FPaths::CollapseRelativeDirectories(Key);
+  return Key;
+}
+
+// Partition cell actors (and their HLOD actors) carry their cell as a tag so
+// a re-import can tell which ones to keep
+static FName MakeRoseCellTag(const FIntPoint &Cell) {
+  return FName(*FString::Printf(TEXT("RoseCell_%d_%d"), Cell.X, Cell.Y));
+}
+
+static bool GetRoseCellTag(const AActor *Actor, FIntPoint &OutCell) {
+  for (const FName &Tag : Actor->Tags) {
+    FString Cell = Tag.ToString(), L, R;
+    if (Cell.RemoveFromStart(TEXT("RoseCell_")) &&
+        Cell.Split(TEXT("_"), &L, &R)) {
+      OutCell = FIntPoint(FCString::Atoi(*L), FCString::Atoi(*R));
+      return true;
+    }
+  }
+  return false;
+}
+
+static const FName RoseLandscapeTag(TEXT("RoseLandscape"));
+
+URoseImportSession &URoseImporter::GetSession() {
+  if (!Session) {
+    Session = URoseImportSession::Get();
+    if (!Session) {
+      // No editor (commandlet): the caches live as long as this importer
+      Session = NewObject<URoseImportSession>(this);
+    }
+  }
+  return *Session;
+}
 
 bool URoseImporter::ImportZone(const FString &ZONPath) {
   FScopedSlowTask SlowTask(3.0f, NSLOCTEXT("RoseImporter", "ImportingZone",
                                            "Importing ROSE Zone..."));
   SlowTask.MakeDialog();
 
+  // Write every asset touched by this import in one batch, also on early out
+  ON_SCOPE_EXIT { FlushPendingSaves(); };
+
   SlowTask.EnterProgressFrame(
       1.0f, NSLOCTEXT("RoseImporter", "LoadingFiles", "Loading Files..."));
   FRoseZON ZON;
@@ -99,9 +166,10 @@ bool URoseImporter::ImportZone(const FString &ZONPath) {
   }
   FPaths::NormalizeFilename(RoseRootPath);
   UE_LOG(LogRoseImporter, Log, TEXT("Final Rose Root Path: %s"), *RoseRootPath);
+  GetSession().BeginImport(RoseRootPath);
 
   // Load ZONETYPEINFO.STB for TileSet lookup
-  bZoneTypeInfoLoaded = false;
+  ZoneTypeInfoSTB.Reset();
   bCurrentTileSetValid = false;
 
   if (LoadZoneTypeInfo(RoseRootPath)) {
@@ -142,6 +210,7 @@ bool URoseImporter::ImportZone(const FString &ZONPath) {
     UE_LOG(LogRoseImporter, Warning,
            TEXT("Failed to load associated ZSCs for zone %s"), *ZoneDirName);
   }
+  GetSession().CheckMaterialSources({DecoZSC.Path, CnstZSC.Path});
 
   UWorld *World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
   if (!World)
@@ -178,22 +247,270 @@ bool URoseImporter::ImportZone(const FString &ZONPath) {
   if (TilesToLoad.Num() == 0)
     return false;
 
+  // Load every IFO first: the meshes they reference are built in one
+  // parallel batch before any placement, and a re-import compares what
+  // they place with the previous import
+  TArray<FRoseIFO> TileIFOs;
+  TArray<FString> TileIFONames;
+  TArray<FIntPoint> TileIFOTiles;
+  TMap<FIntPoint, int32> TileIFOIndex;
+  for (const FTileInfo &Tile : TilesToLoad) {
+    FString IFOPath = FPaths::Combine(Folder, Tile.BaseName + TEXT(".ifo"));
+    if (FPaths::FileExists(IFOPath)) {
+      FRoseIFO IFO;
+      if (IFO.Load(IFOPath)) {
+        TileIFOIndex.Add(FIntPoint(Tile.X, Tile.Y), TileIFOs.Num());
+        TileIFOs.Add(MoveTemp(IFO));
+        TileIFONames.Add(Tile.BaseName);
+        TileIFOTiles.Add(FIntPoint(Tile.X, Tile.Y));
+      }
+    }
+  }
+
   // Clear previous state
   GlobalHISMMap.Empty();
-  ProcessedMaterialPaths.Empty();
+  ZoneHISMs.Empty();
+  PendingHISMInstances.Empty();
+  ResolvedParts.Empty();
+  PartCacheHits = 0;
+  ResolvedPrefabs.Empty();
+  PartitionActors.Empty();
+  AnimManager = nullptr;
+  AnimClipCache.Empty();
+  AnimClipCacheHits = 0;
+  AnimBakeTextures.Empty();
+  PendingHISMCustomData.Empty();
+  ObjectCullRules.Empty();
+  MeshCollisionUses.Empty();
+  bRestrictToRebuildCells = false;
+  RebuildCells.Empty();
+  StaleSourceFiles.Empty();
+  RefreshedAssets.Empty();
+  Report = FRoseImportReport();
+  CurrentZoneName = ZoneDirName;
+
+  // Manifest of this import: per tile the HIM/TIL/IFO hashes, the ZMS, ZMO
+  // and texture files its objects use and the cells they land in
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+  TArray<FRoseTileManifest> NewTiles;
+  TMap<FString, FString> FileHashes;
+  TMap<FString, FString> TextureFiles;
+  for (const FTileInfo &Tile : TilesToLoad) {
+    FRoseTileManifest &Entry = NewTiles.AddDefaulted_GetRef();
+    Entry.Tile = FIntPoint(Tile.X, Tile.Y);
+    for (const TCHAR *Ext : {TEXT(".him"), TEXT(".til"), TEXT(".ifo")}) {
+      FileHashes.Add(
+          MakeRoseSourceKey(FPaths::Combine(Folder, Tile.BaseName + Ext)));
+    }
+    if (const int32 *IFOIndex = TileIFOIndex.Find(Entry.Tile)) {
+      TSet<FString> Sources;
+      CollectIFOSources(TileIFOs[*IFOIndex], Sources, TextureFiles);
+      Entry.Sources = Sources.Array();
+      Entry.Sources.Sort();
+      TSet<FIntPoint> Cells;
+      CollectIFOCells(TileIFOs[*IFOIndex], Cells);
+      Entry.Cells = Cells.Array();
+    }
+    for (const FString &Source : Entry.Sources) {
+      FileHashes.Add(Source);
+    }
+  }
+  TArray<FString> TerrainTextures;
+  for (const FString &Texture : ZON.Textures) {
+    const FString Path = ResolveRoseTexturePath(Texture);
+    if (!Path.IsEmpty()) {
+      TerrainTextures.Add(MakeRoseSourceKey(Path));
+      FileHashes.Add(TerrainTextures.Last());
+    }
+  }
+  TArray<FString> ZoneFiles = {MakeRoseSourceKey(ZONPath)};
+  for (const FRoseZSC *ZSC : {&DecoZSC, &CnstZSC, &AnimZSC}) {
+    if (!ZSC->Path.IsEmpty()) {
+      ZoneFiles.Add(MakeRoseSourceKey(ZSC->Path));
+    }
+  }
+  for (const FString &Path : ZoneFiles) {
+    FileHashes.Add(Path);
+  }
+
+  {
+    const double HashStart = FPlatformTime::Seconds();
+    TArray<FString> HashPaths;
+    FileHashes.GenerateKeyArray(HashPaths);
+    TArray<FString> HashValues;
+    HashValues.SetNum(HashPaths.Num());
+    ParallelFor(HashPaths.Num(), [&](int32 Index) {
+      // Missing files hash to an empty string
+      HashValues[Index] = LexToString(FMD5Hash::HashFile(*HashPaths[Index]));
+    });
+    for (int32 i = 0; i < HashPaths.Num(); ++i) {
+      FileHashes[HashPaths[i]] = HashValues[i];
+    }
+    Report.HashSeconds = FPlatformTime::Seconds() - HashStart;
+    UE_LOG(LogRoseImporter, Log, TEXT("[Reimport] Hashed %d files in %.2fs"),
+           HashPaths.Num(), Report.HashSeconds);
+  }
+
+  TMap<FString, FString> NewSourceHashes;
+  for (int32 i = 0; i < NewTiles.Num(); ++i) {
+    FRoseTileManifest &Entry = NewTiles[i];
+    const FString &Base = TilesToLoad[i].BaseName;
+    Entry.HIMHash = FileHashes.FindRef(
+        MakeRoseSourceKey(FPaths::Combine(Folder, Base + TEXT(".him"))));
+    Entry.TILHash = FileHashes.FindRef(
+        MakeRoseSourceKey(FPaths::Combine(Folder, Base + TEXT(".til"))));
+    Entry.IFOHash = FileHashes.FindRef(
+        MakeRoseSourceKey(FPaths::Combine(Folder, Base + TEXT(".ifo"))));
+    for (const FString &Source : Entry.Sources) {
+      NewSourceHashes.Add(Source, FileHashes.FindRef(Source));
+    }
+  }
+  for (const FString &Texture : TerrainTextures) {
+    NewSourceHashes.Add(Texture, FileHashes.FindRef(Texture));
+  }
+
+  // Anything that affects every tile (ZON, ZSC lists, importer settings)
+  // goes into one zone hash; a mismatch means a full import
+  FString Signature =
+      FString::Printf(TEXT("Version=%d\n"), RoseZoneManifestVersion);
+  for (const FString &Path : ZoneFiles) {
+    Signature += Path + TEXT("=") + FileHashes.FindRef(Path) + TEXT("\n");
+  }
+  for (TFieldIterator<FProperty> It(URoseImportSettings::StaticClass()); It;
+       ++It) {
+    FString Value;
+    It->ExportTextItem_InContainer(Value, Settings, nullptr, nullptr,
+                                   PPF_None);
+    Signature += It->GetName() + TEXT("=") + Value + TEXT("\n");
+  }
+  const FString ZoneHash = FMD5::HashAnsiString(*Signature);
 
-  // Find and destroy any existing ZoneObjects actor with the same name
+  // Find the actors of a previous import of this zone: the ZoneObjects
+  // actor, partition cell actors, HLOD actors, the landscape and animated
+  // object actors
   FString ActorName = TEXT("ZoneObjects_") + ZoneDirName;
+  const FName ZoneTag(*(TEXT("RoseZone_") + ZoneDirName));
+  TArray<AActor *> ZoneActors;
+  bool bHasCellActors = false;
+  bool bHasLandscape = false;
   for (TActorIterator<AActor> It(World); It; ++It) {
     AActor *ExistingActor = *It;
-    if (ExistingActor && ExistingActor->GetName() == ActorName) {
-      UE_LOG(LogRoseImporter, Warning,
-             TEXT("[Import] Destroying existing actor: %s"), *ActorName);
-      World->DestroyActor(ExistingActor);
-      break;
+    if (ExistingActor && (ExistingActor->GetName() == ActorName ||
+                          ExistingActor->Tags.Contains(ZoneTag))) {
+      ZoneActors.Add(ExistingActor);
+      FIntPoint Cell;
+      bHasCellActors |= GetRoseCellTag(ExistingActor, Cell);
+      bHasLandscape |= ExistingActor->Tags.Contains(RoseLandscapeTag);
+    }
+  }
+
+  // Incremental re-import needs per-cell actors to keep, and a previous
+  // import with the same zone-wide inputs
+  URoseMapInfo *Manifest = GetOrCreateZoneManifest(ZoneDirName);
+  const bool bIncremental =
+      Settings->bIncrementalReimport &&
+      Settings->HISMPartition != ERoseHISMPartition::None &&
+      Settings->bSpawnPartitionActors && bHasCellActors &&
+      Manifest->ZoneHash == ZoneHash;
+
+  // Sources whose content changed are rebuilt even if their asset exists
+  for (const TPair<FString, FString> &Elem : NewSourceHashes) {
+    const FString *OldHash = Manifest->SourceHashes.Find(Elem.Key);
+    if (OldHash && *OldHash != Elem.Value) {
+      StaleSourceFiles.Add(Elem.Key);
+    }
+  }
+
+  // Tiles to place again, and cells whose old contents have to go
+  TSet<FIntPoint> ChangedTiles;
+  TSet<FIntPoint> DirtyCells;
+  bool bTerrainChanged = !bHasLandscape;
+  if (bIncremental) {
+    TSet<FIntPoint> CurrentTiles;
+    for (const FRoseTileManifest &Entry : NewTiles) {
+      CurrentTiles.Add(Entry.Tile);
+      const FRoseTileManifest *Old = Manifest->FindTile(Entry.Tile);
+      if (!Old) {
+        bTerrainChanged = true;
+        ChangedTiles.Add(Entry.Tile);
+        DirtyCells.Append(Entry.Cells);
+        continue;
+      }
+      bTerrainChanged |=
+          Old->HIMHash != Entry.HIMHash || Old->TILHash != Entry.TILHash;
+
+      bool bChanged = Old->IFOHash != Entry.IFOHash ||
+                      Old->Sources != Entry.Sources;
+      for (const FString &Source : Entry.Sources) {
+        bChanged |= StaleSourceFiles.Contains(Source);
+      }
+      if (bChanged) {
+        ChangedTiles.Add(Entry.Tile);
+        DirtyCells.Append(Old->Cells);
+        DirtyCells.Append(Entry.Cells);
+      }
+    }
+    for (const FRoseTileManifest &Old : Manifest->Tiles) {
+      if (!CurrentTiles.Contains(Old.Tile)) {
+        bTerrainChanged = true;
+        DirtyCells.Append(Old.Cells);
+      }
+    }
+    for (const FString &Texture : TerrainTextures) {
+      bTerrainChanged |= StaleSourceFiles.Contains(Texture);
+    }
+
+    if (ChangedTiles.Num() == 0 && DirtyCells.Num() == 0 &&
+        !bTerrainChanged) {
+      UE_LOG(LogRoseImporter, Log,
+             TEXT("[Reimport] %s is up to date, nothing to import"),
+             *ZoneDirName);
+      return true;
     }
   }
 
+  // Unchanged tiles with objects in a dirty cell are placed again too; their
+  // placements in kept cells are skipped by GetOrCreateHISM
+  TSet<FIntPoint> TilesToPlace = ChangedTiles;
+  if (bIncremental) {
+    for (const FRoseTileManifest &Entry : NewTiles) {
+      for (const FIntPoint &Cell : Entry.Cells) {
+        if (DirtyCells.Contains(Cell)) {
+          TilesToPlace.Add(Entry.Tile);
+          break;
+        }
+      }
+    }
+    bRestrictToRebuildCells = true;
+    RebuildCells = DirtyCells;
+  }
+
+  // Destroy the previous import's actors. An incremental re-import keeps
+  // the cell actors (and their HLOD actors) of clean cells, and the
+  // landscape when no terrain file changed; the ZoneObjects actor and
+  // animated objects are always rebuilt.
+  TArray<AActor *> StaleActors;
+  TSet<FIntPoint> KeptCells;
+  for (AActor *ExistingActor : ZoneActors) {
+    FIntPoint Cell;
+    if (bIncremental && GetRoseCellTag(ExistingActor, Cell) &&
+        !DirtyCells.Contains(Cell)) {
+      KeptCells.Add(Cell);
+      continue;
+    }
+    if (bIncremental && !bTerrainChanged &&
+        ExistingActor->Tags.Contains(RoseLandscapeTag)) {
+      continue;
+    }
+    StaleActors.Add(ExistingActor);
+  }
+  for (AActor *StaleActor : StaleActors) {
+    UE_LOG(LogRoseImporter, Warning,
+           TEXT("[Import] Destroying existing actor: %s"),
+           *StaleActor->GetName());
+    World->DestroyActor(StaleActor);
+  }
+
   // Also destroy the old ZoneObjectsActor if it exists
   if (ZoneObjectsActor) {
     if (World->ContainsActor(ZoneObjectsActor)) {
@@ -223,15 +540,28 @@ bool URoseImporter::ImportZone(const FString &ZONPath) {
   RootComp->RegisterComponent();
 
   ZoneObjectsActor->SetActorLabel(TEXT("ZoneObjects_") + ZoneDirName);
+  ZoneObjectsActor->Tags.Add(ZoneTag);
 
 #if WITH_EDITOR
   ZoneObjectsActor->SetFolderPath(FName(*(TEXT("Rose/") + ZoneDirName)));
 #endif
 
-  // PHASE 1: COLLECT ALL TILES
+  Report.bIncremental = bIncremental;
+  Report.bLandscapeRebuilt = !bIncremental || bTerrainChanged;
+  if (bIncremental) {
+    Report.TilesRebuilt = TilesToPlace.Num();
+    Report.TilesKept = NewTiles.Num() - TilesToPlace.Num();
+    Report.CellsRebuilt = DirtyCells.Num();
+    Report.CellsKept = KeptCells.Num();
+  }
+
+  // PHASE 1: COLLECT ALL TILES (only needed to build the landscape)
+  double PhaseStart = FPlatformTime::Seconds();
   TArray<FLoadedTile> AllTiles;
 
   for (const auto &Tile : TilesToLoad) {
+    if (!Report.bLandscapeRebuilt)
+      break;
     TArray<uint8> Data;
     FString HIMPath = FPaths::Combine(Folder, Tile.BaseName + TEXT(".him"));
     if (FFileHelper::LoadFileToArray(Data, *HIMPath)) {
@@ -249,17 +579,25 @@ bool URoseImporter::ImportZone(const FString &ZONPath) {
     }
   }
 
-  if (AllTiles.Num() == 0) {
-    return false;
-  }
-
-  UE_LOG(LogRoseImporter, Log,
-         TEXT("Loaded %d tiles, creating unified landscape..."),
-         AllTiles.Num());
+  if (Report.bLandscapeRebuilt) {
+    if (AllTiles.Num() == 0) {
+      return false;
+    }
 
-  // PHASE 2: CREATE UNIFIED LANDSCAPE (Matches Reference Plugin approach)
-  // This creates a single global landscape with merged heightmap and layers.
-  CreateUnifiedLandscape(AllTiles, ZON, World, MinX, MinY, MaxX, MaxY, Folder);
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("Loaded %d tiles, creating unified landscape..."),
+           AllTiles.Num());
+
+    // PHASE 2: CREATE UNIFIED LANDSCAPE (Matches Reference Plugin approach)
+    // This creates a single global landscape with merged heightmap and
+    // layers.
+    CreateUnifiedLandscape(AllTiles, ZON, World, MinX, MinY, MaxX, MaxY,
+                           Folder);
+    Report.LandscapeSeconds = FPlatformTime::Seconds() - PhaseStart;
+  } else {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Reimport] Terrain unchanged, keeping the landscape"));
+  }
 
   /* Individual Landscapes Removed - using Unified Global Landscape instead */
 
@@ -270,47 +608,84 @@ bool URoseImporter::ImportZone(const FString &ZONPath) {
   // Current logic: ProcessHeightmap spawns discrete landscapes?
   // Wait, ProcessHeightmap spawns ALandscape actors.
 
-  float WorkPerTile = 1.0f / FMath::Max(1, TilesToLoad.Num());
+  int32 ZoneWidth = MaxX - MinX + 1;
+  int32 ZoneHeight = MaxY - MinY + 1;
 
-  for (const FTileInfo &Tile : TilesToLoad) {
+  PrebuildZoneMeshes(TileIFOs);
+
+  // Meshes built on demand during placement count as mesh build time
+  PhaseStart = FPlatformTime::Seconds();
+  const double BuildSecondsBefore = Report.MeshBuildSeconds;
+  float WorkPerTile = 1.0f / FMath::Max(1, TileIFOs.Num());
+
+  for (int32 i = 0; i < TileIFOs.Num(); ++i) {
     SlowTask.EnterProgressFrame(
         WorkPerTile,
         FText::Format(NSLOCTEXT("RoseImporter", "SpawningObjects",
                                 "Spawning Objects for Tile {0}..."),
-                      FText::FromString(Tile.BaseName)));
+                      FText::FromString(TileIFONames[i])));
 
-    FString IFOPath = FPaths::Combine(Folder, Tile.BaseName + TEXT(".ifo"));
-    if (FPaths::FileExists(IFOPath)) {
-      FRoseIFO IFO;
-      if (IFO.Load(IFOPath)) {
-        // FIX: IFO positions are GLOBAL — no tile offset needed.
-        // Reference plugin uses obj.Position directly.
-        int32 ZoneWidth = MaxX - MinX + 1;
-        int32 ZoneHeight = MaxY - MinY + 1;
+    // Tiles left alone by a re-import still place their animated objects,
+    // which live on the rebuilt ZoneObjects actor
+    const bool bAnimatedOnly =
+        bIncremental && !TilesToPlace.Contains(TileIFOTiles[i]);
 
-        ProcessObjects(IFO, World, FVector::ZeroVector, MinX, MinY, ZoneWidth,
-                       ZoneHeight);
-      }
-    }
+    // FIX: IFO positions are GLOBAL — no tile offset needed.
+    // Reference plugin uses obj.Position directly.
+    ProcessObjects(TileIFOs[i], World, FVector::ZeroVector, MinX, MinY,
+                   ZoneWidth, ZoneHeight, bAnimatedOnly);
   }
 
+  Report.PlacementSeconds = FPlatformTime::Seconds() - PhaseStart -
+                            (Report.MeshBuildSeconds - BuildSecondsBefore);
+
   // PHASE 4: FINALIZE HISM COMPONENTS (Deferred Registration & Attachment)
+  PhaseStart = FPlatformTime::Seconds();
   UE_LOG(LogRoseImporter, Log,
          TEXT("Finalizing (Attach+Register) %d HISM Components..."),
-         GlobalHISMMap.Num());
-  for (auto &Elem : GlobalHISMMap) {
-    if (Elem.Value) {
-      if (!Elem.Value->GetAttachParent()) {
-        Elem.Value->AttachToComponent(
-            ZoneObjectsActor->GetRootComponent(),
+         ZoneHISMs.Num());
+  for (UHierarchicalInstancedStaticMeshComponent *HISM : ZoneHISMs) {
+    if (HISM) {
+      if (!HISM->GetAttachParent()) {
+        HISM->AttachToComponent(
+            HISM->GetOwner()->GetRootComponent(),
             FAttachmentTransformRules::KeepRelativeTransform);
       }
-      if (!Elem.Value->IsRegistered()) {
-        Elem.Value->RegisterComponent();
+      if (!HISM->IsRegistered()) {
+        HISM->RegisterComponent();
       }
     }
   }
 
+  FlushHISMInstances();
+  BuildZoneHLODs(World);
+  Report.FinalizeSeconds = FPlatformTime::Seconds() - PhaseStart;
+
+  if (PartitionActors.Num() > 0) {
+    UE_LOG(LogRoseImporter, Log, TEXT("[HISM] %d partition cell actors"),
+           PartitionActors.Num());
+  }
+
+  UE_LOG(LogRoseImporter, Log,
+         TEXT("[PartCache] %d unique parts resolved, %d cache hits"),
+         ResolvedParts.Num(), PartCacheHits);
+
+  Report.HISMCount = ZoneHISMs.Num();
+  for (const TPair<int32, int32> &Elem : Report.CullRuleInstances) {
+    Report.InstanceCount += Elem.Value;
+  }
+  Report.AnimClipCount = AnimClipCache.Num();
+  Report.AnimClipCacheHits = AnimClipCacheHits;
+  Report.StaleAssetsRebuilt = RefreshedAssets.Num();
+  Report.Log(ZoneDirName);
+  GetSession().LogStats();
+
+  Manifest->OriginalZONPath = ZONPath;
+  Manifest->ZoneHash = ZoneHash;
+  Manifest->Tiles = MoveTemp(NewTiles);
+  Manifest->SourceHashes = MoveTemp(NewSourceHashes);
+  SaveRoseAsset(Manifest);
+
   UE_LOG(LogRoseImporter, Log, TEXT("Zone Import Complete."));
   return true;
 }
@@ -1179,6 +1554,8 @@ void URoseImporter::CreateUnifiedLandscape(const TArray<FLoadedTile> &AllTiles,
 
   if (Landscape) {
     Landscape->SetActorLabel(TEXT("RoseZone_UnifiedLandscape"));
+    Landscape->Tags.Add(FName(*(TEXT("RoseZone_") + CurrentZoneName)));
+    Landscape->Tags.Add(RoseLandscapeTag);
     Landscape->SetActorScale3D(FVector(250.0f, 250.0f, 100.0f));
 
     // STEP 5: Create and assign 12-layer
@@ -1775,17 +2152,58 @@ void URoseImporter::ProcessHeightmap(const FRoseHIM &HIM, const FRoseTIL &TIL,
   }
 }
 
+// Rejects NaN, degenerate and far out of range placements
+static bool IsPlaceableTransform(const FTransform &Transform) {
+  return !Transform.ContainsNaN() && Transform.IsValid() &&
+         Transform.GetLocation().Size() <= 10000000.0f &&
+         !Transform.GetScale3D().IsNearlyZero();
+}
+
+// Opaque (0), masked (1) or translucent (2), as GetOrCreateMeshMaterial
+// picks the master material
+static int32 GetRoseBlendClass(const FRoseZSC::FMaterialEntry *M) {
+  if (!M || !M->AlphaEnabled)
+    return 0;
+  if (M->AlphaTest > 0)
+    return 1;
+  return M->BlendType != 0 ? 2 : 0;
+}
+
+// Objects bMergeObjectPrefabs can bake: several static parts with valid
+// meshes and a single blend class
+static bool IsRosePrefabCandidate(const FRoseZSC &ZSC,
+                                  const FRoseZSC::FObjectEntry &Object) {
+  if (Object.Parts.Num() < 2)
+    return false;
+  int32 BlendClass = INDEX_NONE;
+  for (const FRoseZSC::FObjectPart &Part : Object.Parts) {
+    if (!Part.AnimPath.IsEmpty() || !ZSC.Meshes.IsValidIndex(Part.MeshIndex))
+      return false;
+    const int32 PartClass = GetRoseBlendClass(
+        ZSC.Materials.IsValidIndex(Part.MaterialIndex)
+            ? &ZSC.Materials[Part.MaterialIndex]
+            : nullptr);
+    if (BlendClass != INDEX_NONE && PartClass != BlendClass)
+      return false;
+    BlendClass = PartClass;
+  }
+  return true;
+}
+
 void URoseImporter::ProcessObjects(const FRoseIFO &IFO, UWorld *World,
                                    const FVector &TileOffset, int32 MinX,
                                    int32 MinY, int32 ZoneWidth,
-                                   int32 ZoneHeight) {
+                                   int32 ZoneHeight, bool bAnimatedOnly) {
   if (!ZoneObjectsActor)
     return;
 
   // Helper lambda to process a list of
   // objects vs a specific ZSC
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+  const bool bMergePrefabs = Settings->bMergeObjectPrefabs;
   auto ProcessList = [&, this](const TArray<FRoseMapObject> &MapObjects,
-                               FRoseZSC &ZSC, const FString &DebugCtx) {
+                               FRoseZSC &ZSC, ERoseObjectSource Source,
+                               const FString &DebugCtx) {
     if (!ZoneObjectsActor) {
       UE_LOG(LogRoseImporter, Error,
              TEXT("ZoneObjectsActor is null "
@@ -1809,10 +2227,61 @@ void URoseImporter::ProcessObjects(const FRoseIFO &IFO, UWorld *World,
         continue;
       }
 
+      // Merged objects are placed once, with the object transform
+      FRoseResolvedPart *Prefab =
+          bMergePrefabs && !bAnimatedOnly &&
+                  Source != ERoseObjectSource::Anim && ZSCObj.Parts.Num() > 1
+              ? ResolvePrefab(ZSC, MapObj.ObjectID, Source)
+              : nullptr;
+      if (Prefab && Prefab->Mesh) {
+        const FTransform ObjectTransform(MapObj.Rotation, MapObj.Position,
+                                         MapObj.Scale);
+        if (!IsPlaceableTransform(ObjectTransform))
+          continue;
+
+        const FRoseZSC::FObjectPart &First = ZSCObj.Parts[0];
+        const FString &FirstMeshPath = ZSC.Meshes[First.MeshIndex].MeshPath;
+        if (!Prefab->bHasHISMKey) {
+          Prefab->HISMKey = MakeHISMKey(
+              Prefab->Mesh,
+              ZSC.Materials.IsValidIndex(First.MaterialIndex)
+                  ? &ZSC.Materials[First.MaterialIndex]
+                  : nullptr,
+              FirstMeshPath);
+          Prefab->bHasHISMKey = true;
+        }
+
+        const TPair<const FRoseZSC::FObjectEntry *, int32> RuleKey(
+            &ZSCObj, INDEX_NONE);
+        const int32 *CachedRule = ObjectCullRules.Find(RuleKey);
+        const int32 CullRule =
+            CachedRule
+                ? *CachedRule
+                : ObjectCullRules.Add(
+                      RuleKey, Settings->FindCullDistanceRule(
+                                   Source, FirstMeshPath,
+                                   (ZSCObj.BBMax - ZSCObj.BBMin)
+                                       .GetAbs()
+                                       .GetMax()));
+
+        FRoseHISMKey Key = Prefab->HISMKey;
+        Key.Cell = GetPartitionCell(MapObj, ObjectTransform.GetLocation());
+        Key.CullRule = CullRule;
+        QueueHISMInstance(GetOrCreateHISM(Key, DebugCtx), ObjectTransform);
+        Report.CullRuleInstances.FindOrAdd(CullRule)++;
+        Report.PrefabInstanceCount++;
+        Report.PrefabPartInstancesSaved += ZSCObj.Parts.Num() - 1;
+        SpawnCount++;
+        continue;
+      }
+
       for (const FRoseZSC::FObjectPart &Part : ZSCObj.Parts) {
         if (Part.MeshIndex < 0 || Part.MeshIndex >= ZSC.Meshes.Num()) {
           continue;
         }
+        if (bAnimatedOnly && Part.AnimPath.IsEmpty()) {
+          continue;
+        }
 
         const FString &MeshPath = ZSC.Meshes[Part.MeshIndex].MeshPath;
         const FRoseZSC::FMaterialEntry *MatEntry = nullptr;
@@ -1822,14 +2291,27 @@ void URoseImporter::ProcessObjects(const FRoseIFO &IFO, UWorld *World,
           MatEntry = &ZSC.Materials[Part.MaterialIndex];
         }
 
-        UStaticMesh *Mesh = ImportRoseMesh(MeshPath, MatEntry, RoseRootPath);
-        if (!Mesh) {
-          continue;
+        // Resolve each (ZSC, mesh, material) once per import; repeated
+        // placements skip path normalization and asset lookups entirely
+        FRosePartKey PartKey{&ZSC, Part.MeshIndex, Part.MaterialIndex};
+        FRoseResolvedPart *Resolved = ResolvedParts.Find(PartKey);
+        if (Resolved) {
+          PartCacheHits++;
+        } else {
+          Resolved = &ResolvedParts.Add(PartKey);
+          UStaticMesh *Imported =
+              ImportRoseMesh(MeshPath, MatEntry, RoseRootPath, Source);
+
+          // Skip meshes with invalid
+          // bounds
+          if (Imported &&
+              !Imported->GetBoundingBox().GetExtent().ContainsNaN()) {
+            Resolved->Mesh = Imported;
+          }
         }
 
-        // Skip meshes with invalid
-        // bounds
-        if (Mesh->GetBoundingBox().GetExtent().ContainsNaN()) {
+        UStaticMesh *Mesh = Resolved->Mesh;
+        if (!Mesh) {
           continue;
         }
 
@@ -1843,56 +2325,53 @@ void URoseImporter::ProcessObjects(const FRoseIFO &IFO, UWorld *World,
                                   CombinedLocal.GetLocation(),
                                   CombinedLocal.GetScale3D());
 
-        // Validate Transform
-        if (FinalTransform.ContainsNaN() || !FinalTransform.IsValid() ||
-            FinalTransform.GetLocation().Size() > 10000000.0f ||
-            FinalTransform.GetScale3D().IsNearlyZero()) {
+        if (!IsPlaceableTransform(FinalTransform)) {
           continue;
         }
 
+        const FIntPoint Cell =
+            GetPartitionCell(MapObj, FinalTransform.GetLocation());
+
         // Animated parts get individual
         // actors; static parts use HISM
         if (!Part.AnimPath.IsEmpty()) {
-          SpawnAnimatedObject(Mesh, FinalTransform, Part.AnimPath, World);
+          // Cull rules see the ZMS path and the whole object's size, as
+          // for static parts
+          SpawnAnimatedObject(
+              Mesh, FinalTransform, Part.AnimPath, World, Cell, MatEntry,
+              MeshPath, (ZSCObj.BBMax - ZSCObj.BBMin).GetAbs().GetMax());
           AnimCount++;
         } else {
-          UHierarchicalInstancedStaticMeshComponent *HISM = nullptr;
-          if (GlobalHISMMap.Contains(Mesh)) {
-            HISM = GlobalHISMMap[Mesh];
-          } else {
-            FString HISMName =
-                TEXT("HISM_") + Mesh->GetName() + TEXT("_") + DebugCtx;
-            HISM = NewObject<UHierarchicalInstancedStaticMeshComponent>(
-                ZoneObjectsActor, *HISMName);
-            HISM->SetStaticMesh(Mesh);
-            HISM->SetMobility(EComponentMobility::Static);
-
-            // [Shadow Fix] Always cast
-            // two-sided shadows to
-            // handle inconsistent face
-            // normals in source data
-            HISM->bCastShadowAsTwoSided = true;
-
-            // Disable shadow casting for
-            // translucent objects
-            if (MatEntry && MatEntry->AlphaEnabled &&
-                MatEntry->BlendType != 0 && MatEntry->AlphaTest == 0) {
-              HISM->SetCastShadow(false);
-            }
-
-            // [Collision Fix] Disable
-            // collision for "grass"
-            if (Mesh->GetName().Contains(TEXT("grass"),
-                                         ESearchCase::IgnoreCase) ||
-                MeshPath.Contains(TEXT("grass"), ESearchCase::IgnoreCase)) {
-              HISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-              HISM->SetCollisionProfileName(
-                  UCollisionProfile::NoCollision_ProfileName);
-            }
+          if (!Resolved->bHasHISMKey) {
+            Resolved->HISMKey = MakeHISMKey(Mesh, MatEntry, MeshPath);
+            Resolved->bHasHISMKey = true;
+          }
 
-            GlobalHISMMap.Add(Mesh, HISM);
+          // Cull rules look at the whole object's bounds, so they are
+          // cached per object and part rather than on the resolved part
+          const TPair<const FRoseZSC::FObjectEntry *, int32> RuleKey(
+              &ZSCObj, Part.MeshIndex);
+          const int32 *CachedRule = ObjectCullRules.Find(RuleKey);
+          const int32 CullRule =
+              CachedRule ? *CachedRule
+                         : ObjectCullRules.Add(
+                               RuleKey,
+                               Settings->FindCullDistanceRule(
+                                   Source, MeshPath,
+                                   (ZSCObj.BBMax - ZSCObj.BBMin)
+                                       .GetAbs()
+                                       .GetMax()));
+
+          FRoseHISMKey Key = Resolved->HISMKey;
+          Key.Cell = Cell;
+          Key.CullRule = CullRule;
+          if (Settings->bUseZSCCollisionMode && Part.bHasCollisionMode &&
+              (Part.CollisionMode & FRoseZSC::COLLISION_SHAPE_MASK) ==
+                  FRoseZSC::COLLISION_NONE) {
+            Key.CollisionProfile = UCollisionProfile::NoCollision_ProfileName;
           }
-          HISM->AddInstance(FinalTransform);
+          QueueHISMInstance(GetOrCreateHISM(Key, DebugCtx), FinalTransform);
+          Report.CullRuleInstances.FindOrAdd(CullRule)++;
         }
         SpawnCount++;
       }
@@ -1905,17 +2384,18 @@ void URoseImporter::ProcessObjects(const FRoseIFO &IFO, UWorld *World,
   };
 
   // Process Decorations
-  ProcessList(IFO.Objects, DecoZSC, TEXT("Deco"));
+  ProcessList(IFO.Objects, DecoZSC, ERoseObjectSource::Deco, TEXT("Deco"));
 
   // Process Buildings
-  ProcessList(IFO.Buildings, CnstZSC, TEXT("Cnst"));
+  ProcessList(IFO.Buildings, CnstZSC, ERoseObjectSource::Cnst, TEXT("Cnst"));
 
   // Process Animations (Flags, etc.)
   // Use the dynamically discovered
   // AnimZSC (or fallback to DecoZSC if
   // empty)
   if (AnimZSC.Meshes.Num() > 0 || AnimZSC.Objects.Num() > 0) {
-    ProcessList(IFO.Animations, AnimZSC, TEXT("AnimObj"));
+    ProcessList(IFO.Animations, AnimZSC, ERoseObjectSource::Anim,
+                TEXT("AnimObj"));
   } else {
     UE_LOG(LogRoseImporter, Warning,
            TEXT("No AnimZSC found, "
@@ -1934,10 +2414,97 @@ void URoseImporter::ProcessObjects(const FRoseIFO &IFO, UWorld *World,
   }
 }
 
-void URoseImporter::SpawnAnimatedObject(UStaticMesh *Mesh,
-                                        const FTransform &Transform,
-                                        const FString &AnimPath,
-                                        UWorld *World) {
+void URoseImporter::CollectIFOSources(
+    const FRoseIFO &IFO, TSet<FString> &OutSources,
+    TMap<FString, FString> &TextureFiles) const {
+  auto CollectList = [&](const TArray<FRoseMapObject> &MapObjects,
+                         const FRoseZSC &ZSC) {
+    for (const FRoseMapObject &MapObj : MapObjects) {
+      if (!ZSC.Objects.IsValidIndex(MapObj.ObjectID))
+        continue;
+      for (const FRoseZSC::FObjectPart &Part :
+           ZSC.Objects[MapObj.ObjectID].Parts) {
+        if (!ZSC.Meshes.IsValidIndex(Part.MeshIndex))
+          continue;
+        OutSources.Add(MakeRoseSourceKey(FPaths::Combine(
+            RoseRootPath, ZSC.Meshes[Part.MeshIndex].MeshPath)));
+        if (!Part.AnimPath.IsEmpty()) {
+          OutSources.Add(
+              MakeRoseSourceKey(FPaths::Combine(RoseRootPath, Part.AnimPath)));
+        }
+        if (ZSC.Materials.IsValidIndex(Part.MaterialIndex) &&
+            !ZSC.Materials[Part.MaterialIndex].TexturePath.IsEmpty()) {
+          const FString &TexturePath =
+              ZSC.Materials[Part.MaterialIndex].TexturePath;
+          FString *File = TextureFiles.Find(TexturePath);
+          if (!File) {
+            FString Resolved = ResolveRoseTexturePath(TexturePath);
+            if (!Resolved.IsEmpty()) {
+              Resolved = MakeRoseSourceKey(Resolved);
+            }
+            File = &TextureFiles.Add(TexturePath, Resolved);
+          }
+          if (!File->IsEmpty()) {
+            OutSources.Add(*File);
+          }
+        }
+      }
+    }
+  };
+  CollectList(IFO.Objects, DecoZSC);
+  CollectList(IFO.Buildings, CnstZSC);
+  CollectList(IFO.Animations, AnimZSC);
+}
+
+void URoseImporter::CollectIFOCells(const FRoseIFO &IFO,
+                                    TSet<FIntPoint> &OutCells) const {
+  // Same transforms as ProcessObjects. Prefab candidates add the object
+  // cell and the part cells, since a failed merge places the parts.
+  const bool bMergePrefabs =
+      GetDefault<URoseImportSettings>()->bMergeObjectPrefabs;
+  auto CollectList = [&](const TArray<FRoseMapObject> &MapObjects,
+                         const FRoseZSC &ZSC, ERoseObjectSource Source) {
+    for (const FRoseMapObject &MapObj : MapObjects) {
+      if (!ZSC.Objects.IsValidIndex(MapObj.ObjectID))
+        continue;
+      const FRoseZSC::FObjectEntry &ZSCObj = ZSC.Objects[MapObj.ObjectID];
+      const FTransform ObjectTransform(MapObj.Rotation, MapObj.Position,
+                                       MapObj.Scale);
+      if (bMergePrefabs && Source != ERoseObjectSource::Anim &&
+          IsRosePrefabCandidate(ZSC, ZSCObj)) {
+        OutCells.Add(GetPartitionCell(MapObj, ObjectTransform.GetLocation()));
+      }
+      for (const FRoseZSC::FObjectPart &Part : ZSCObj.Parts) {
+        const FTransform PartTransform(
+            FQuat(Part.Rotation), FVector(Part.Position), FVector(Part.Scale));
+        OutCells.Add(GetPartitionCell(
+            MapObj, (PartTransform * ObjectTransform).GetLocation()));
+      }
+    }
+  };
+  CollectList(IFO.Objects, DecoZSC, ERoseObjectSource::Deco);
+  CollectList(IFO.Buildings, CnstZSC, ERoseObjectSource::Cnst);
+  CollectList(IFO.Animations, AnimZSC, ERoseObjectSource::Anim);
+}
+
+// Bake texture asset for a ZMO. Clips sharing a base filename in different
+// folders are told apart by a hash of the relative path.
+static FString MakeRoseAnimBakeName(const FString &AnimPath) {
+  FString RelPath = AnimPath;
+  FPaths::NormalizeFilename(RelPath);
+  FPaths::CollapseRelativeDirectories(RelPath);
+  RelPath.ToLowerInline();
+  return FString::Printf(
+      TEXT("T_Anim_%s_%08X"),
+      *ObjectTools::SanitizeObjectName(FPaths::GetBaseFilename(AnimPath)),
+      FCrc::StrCrc32(*RelPath));
+}
+
+void URoseImporter::SpawnAnimatedObject(
+    UStaticMesh *Mesh, const FTransform &Transform, const FString &AnimPath,
+    UWorld *World, const FIntPoint &Cell,
+    const FRoseZSC::FMaterialEntry *MatEntry, const FString &MeshPath,
+    float ObjectSize) {
   if (!World || !Mesh)
     return;
 
@@ -1948,35 +2515,81 @@ void URoseImporter::SpawnAnimatedObject(UStaticMesh *Mesh,
   FString FullAnimPath = FPaths::Combine(RoseRootPath, AnimPath);
   FullAnimPath.ReplaceInline(TEXT("\\"), TEXT("/"));
 
-  FRoseZMO ZMO;
-  if (!ZMO.Load(FullAnimPath)) {
-    UE_LOG(LogRoseImporter, Warning,
-           TEXT("[Anim] Failed to load ZMO: "
-                "%s - spawning static"),
-           *FullAnimPath);
+  FString ClipKey;
+  TSharedPtr<const FRoseAnimClip> Clip = GetAnimClip(FullAnimPath, ClipKey);
+  if (!Clip) {
     // Fall back to static placement
     if (ZoneObjectsActor) {
-      UHierarchicalInstancedStaticMeshComponent *HISM = nullptr;
-      if (GlobalHISMMap.Contains(Mesh)) {
-        HISM = GlobalHISMMap[Mesh];
-      } else {
-        FString HISMName = TEXT("HISM_") + Mesh->GetName() + TEXT("_Fallback");
-        HISM = NewObject<UHierarchicalInstancedStaticMeshComponent>(
-            ZoneObjectsActor, *HISMName);
-        HISM->SetStaticMesh(Mesh);
-        HISM->SetMobility(EComponentMobility::Static);
-        GlobalHISMMap.Add(Mesh, HISM);
-      }
-      HISM->AddInstance(Transform);
+      FRoseHISMKey Key = MakeHISMKey(Mesh, nullptr, AnimPath);
+      Key.Cell = Cell;
+      Key.CullRule = GetDefault<URoseImportSettings>()->FindCullDistanceRule(
+          ERoseObjectSource::Anim, MeshPath, ObjectSize);
+      QueueHISMInstance(GetOrCreateHISM(Key, TEXT("Fallback")), Transform);
+      Report.CullRuleInstances.FindOrAdd(Key.CullRule)++;
     }
     return;
   }
 
-  if (ZMO.FrameCount <= 0 || ZMO.FPS <= 0) {
-    UE_LOG(LogRoseImporter, Warning,
-           TEXT("[Anim] ZMO has no frames "
-                "or invalid FPS: %s"),
-           *AnimPath);
+  if (!Clip->IsPlayable()) {
+    return;
+  }
+
+  Report.AnimatedCount++;
+
+  if (GetDefault<URoseImportSettings>()->bBakeAnimatedObjectsToWPO &&
+      ZoneObjectsActor) {
+    // Incremental re-import: a kept cell's AnimWPO HISM already holds this
+    // instance, so it must not fall through to the other paths either
+    if (bRestrictToRebuildCells && !RebuildCells.Contains(Cell)) {
+      return;
+    }
+    UTexture2D **AnimTex = AnimBakeTextures.Find(ClipKey);
+    if (!AnimTex) {
+      AnimTex = &AnimBakeTextures.Add(
+          ClipKey,
+          CreateAnimBakeTexture(MakeRoseAnimBakeName(AnimPath), *Clip));
+    }
+    UMaterialInterface *AnimMat =
+        *AnimTex ? GetOrCreateAnimWPOMaterial(MatEntry, *AnimTex) : nullptr;
+    if (AnimMat) {
+      FRoseHISMKey Key = MakeHISMKey(Mesh, MatEntry, AnimPath);
+      Key.Material = AnimMat;
+      Key.Cell = Cell;
+      Key.CullRule = GetDefault<URoseImportSettings>()->FindCullDistanceRule(
+          ERoseObjectSource::Anim, MeshPath, ObjectSize);
+      UHierarchicalInstancedStaticMeshComponent *HISM =
+          GetOrCreateHISM(Key, TEXT("AnimWPO"));
+      if (HISM) {
+        if (HISM->NumCustomDataFloats != 3) {
+          // Phase, frame count, FPS (see AddRoseAnimWPOExpressions)
+          HISM->SetNumCustomDataFloats(3);
+          // Animated vertices can leave the rest pose bounds
+          HISM->SetBoundsScale(2.0f);
+        }
+        // Deterministic per-placement phase so identical props do not move
+        // in lockstep
+        FRandomStream Phase(GetTypeHash(Transform.GetLocation()));
+        const float CustomData[3] = {Phase.FRand() * Clip->GetDuration(),
+                                     (float)Clip->FrameCount,
+                                     (float)Clip->FPS};
+        QueueHISMInstance(HISM, Transform, CustomData);
+        Report.CullRuleInstances.FindOrAdd(Key.CullRule)++;
+        Report.AnimBakedCount++;
+        return;
+      }
+    }
+  }
+
+  if (GetDefault<URoseImportSettings>()->bBatchAnimatedObjects &&
+      ZoneObjectsActor) {
+    if (!AnimManager) {
+      AnimManager = NewObject<URoseAnimManagerComponent>(ZoneObjectsActor,
+                                                         TEXT("AnimManager"));
+      AnimManager->RegisterComponent();
+      ZoneObjectsActor->AddInstanceComponent(AnimManager);
+    }
+    AnimManager->AddInstance(Mesh, AnimManager->AddClip(ClipKey, *Clip),
+                             Transform);
     return;
   }
 
@@ -1992,6 +2605,7 @@ void URoseImporter::SpawnAnimatedObject(UStaticMesh *Mesh,
 
   Actor->SetActorLabel(
       FString::Printf(TEXT("Anim_%s"), *FPaths::GetBaseFilename(AnimPath)));
+  Actor->Tags.Add(FName(*(TEXT("RoseZone_") + CurrentZoneName)));
 
   // Add root scene component
   USceneComponent *Root = NewObject<USceneComponent>(Actor, TEXT("Root"));
@@ -2013,105 +2627,821 @@ void URoseImporter::SpawnAnimatedObject(UStaticMesh *Mesh,
   // (tick-based, applies ZMO keyframes)
   URoseAnimComponent *AnimComp =
       NewObject<URoseAnimComponent>(Actor, TEXT("AnimDriver"));
-  AnimComp->FPS = ZMO.FPS;
-  AnimComp->FrameCount = ZMO.FrameCount;
-  AnimComp->Duration = (float)ZMO.FrameCount / (float)ZMO.FPS;
+  AnimComp->Clip = Clip;
   AnimComp->TargetComponent = MeshComp;
 
-  // Copy channel data into the component
-  for (const FRoseAnimChannel &Chan : ZMO.Channels) {
-    // FIX: Only apply animation for the
-    // Root Bone (0). Child bones/dummies
-    // should not drive the entire mesh
-    // transform.
-    if (Chan.BoneID != 0)
-      continue;
+  // Random phase so identical props are out of step, and a random first
+  // tick so throttled components spread over frames
+  FRandomStream Phase(GetTypeHash(Transform.GetLocation()));
+  AnimComp->ElapsedTime = Phase.FRand() * Clip->GetDuration();
+  AnimComp->SetComponentTickInterval(
+      Phase.FRand() * URoseAnimComponent::FarTickInterval);
+  AnimComp->RegisterComponent();
 
-    if (Chan.Type == 2 && Chan.PosKeys.Num() > 0) {
-      AnimComp->PosKeys = Chan.PosKeys;
-    } else if (Chan.Type == 4 && Chan.RotKeys.Num() > 0) {
-      AnimComp->RotKeys = Chan.RotKeys;
-    } else if (Chan.Type == 1024 && Chan.ScaleKeys.Num() > 0) {
-      AnimComp->ScaleKeys = Chan.ScaleKeys;
-    }
-  }
+  UE_LOG(LogRoseImporter, Verbose, TEXT("[Anim] Spawned: %s"), *AnimPath);
+}
 
-  AnimComp->RegisterComponent();
+TSharedPtr<const FRoseAnimClip>
+URoseImporter::GetAnimClip(const FString &FullAnimPath, FString &OutClipKey) {
+  OutClipKey = FullAnimPath;
+  FPaths::NormalizeFilename(OutClipKey);
+  OutClipKey.ToLowerInline();
 
-  UE_LOG(LogRoseImporter, Log,
-         TEXT("[Anim] Spawned: %s (%d "
-              "frames @ %d FPS, Pos:%d "
-              "Rot:%d Scl:%d)"),
-         *AnimPath, ZMO.FrameCount, ZMO.FPS, AnimComp->PosKeys.Num(),
-         AnimComp->RotKeys.Num(), AnimComp->ScaleKeys.Num());
+  if (const TSharedPtr<const FRoseAnimClip> *Cached =
+          AnimClipCache.Find(OutClipKey)) {
+    AnimClipCacheHits++;
+    return *Cached;
+  }
+
+  // Parsed once per editor session, until the file changes
+  TSharedPtr<const FRoseAnimClip> Clip = GetSession().GetAnimClip(FullAnimPath);
+  AnimClipCache.Add(OutClipKey, Clip);
+  return Clip;
+}
+FRoseHISMKey
+URoseImporter::MakeHISMKey(UStaticMesh *Mesh, const FRoseZSC::FMaterialEntry *M,
+                           const FString &MeshPath) const {
+  FRoseHISMKey Key;
+  Key.Mesh = Mesh;
+  Key.Material = Mesh ? Mesh->GetMaterial(0) : nullptr;
+
+  // Disable shadow casting for
+  // translucent objects
+  Key.bCastShadow =
+      !(M && M->AlphaEnabled && M->BlendType != 0 && M->AlphaTest == 0);
+
+  // [Collision Fix] Disable
+  // collision for "grass"
+  const bool bGrass =
+      (Mesh && Mesh->GetName().Contains(TEXT("grass"),
+                                        ESearchCase::IgnoreCase)) ||
+      MeshPath.Contains(TEXT("grass"), ESearchCase::IgnoreCase);
+  if (bGrass) {
+    Key.CollisionProfile = UCollisionProfile::NoCollision_ProfileName;
+    Key.CullClass = ERoseCullClass::Grass;
+  }
+  return Key;
 }
-void URoseImporter::EnsureMasterMaterial() {
-  auto EnsureVariant = [&](UMaterial *&MatPtr, const FString &Name,
-                           EBlendMode BlendMode) {
-    FString PN = TEXT("/Game/Rose/Materials/") + Name;
-    // Always try to load first
-    if (!MatPtr)
-      MatPtr = Cast<UMaterial>(FSoftObjectPath(PN).TryLoad());
 
-    bool bNeedsBuild = false;
+UHierarchicalInstancedStaticMeshComponent *
+URoseImporter::GetOrCreateHISM(const FRoseHISMKey &Key,
+                               const FString &DebugCtx) {
+  // Incremental re-import: kept cells already hold these instances
+  if (bRestrictToRebuildCells && !RebuildCells.Contains(Key.Cell)) {
+    return nullptr;
+  }
+  if (UHierarchicalInstancedStaticMeshComponent **Found =
+          GlobalHISMMap.Find(Key)) {
+    return *Found;
+  }
+  AActor *Owner = GetHISMOwner(Key.Cell);
+  if (!Owner || !Key.Mesh)
+    return nullptr;
 
-    // If not found, create it
-    if (!MatPtr) {
-      UE_LOG(LogRoseImporter, Log,
-             TEXT("[Material] Creating new "
-                  "master material: %s"),
-             *Name);
-      UPackage *P = CreatePackage(*PN);
-      MatPtr = (UMaterial *)NewObject<UMaterialFactoryNew>()->FactoryCreateNew(
-          UMaterial::StaticClass(), P, *Name, RF_Public | RF_Standalone,
-          nullptr, GWarn);
-      bNeedsBuild = true;
-    } else {
-      // Only rebuild if empty (check if
-      // expressions exist)
-      if (MatPtr->GetExpressionCollection().Expressions.Num() == 0) {
-        bNeedsBuild = true;
-      }
-    }
+  // The same mesh can now own several components, keep names unique
+  FName HISMName = MakeUniqueObjectName(
+      Owner, UHierarchicalInstancedStaticMeshComponent::StaticClass(),
+      FName(*(TEXT("HISM_") + Key.Mesh->GetName() + TEXT("_") + DebugCtx)));
+  UHierarchicalInstancedStaticMeshComponent *HISM =
+      NewObject<UHierarchicalInstancedStaticMeshComponent>(Owner, HISMName);
+  HISM->SetStaticMesh(Key.Mesh);
+  HISM->SetMobility(EComponentMobility::Static);
+
+  if (Key.Material && Key.Material != Key.Mesh->GetMaterial(0)) {
+    HISM->SetMaterial(0, Key.Material);
+  }
 
-    // Only update content if needed
-    // (Prevents constant
-    // Saving/Rebuilding)
-    if (MatPtr && bNeedsBuild) {
-      // Clear existing expressions to
-      // rebuild clean
-      MatPtr->GetExpressionCollection().Empty();
+  // [Shadow Fix] Always cast
+  // two-sided shadows to
+  // handle inconsistent face
+  // normals in source data
+  HISM->bCastShadowAsTwoSided = true;
+  if (!Key.bCastShadow) {
+    HISM->SetCastShadow(false);
+  }
 
-      auto BT = NewObject<UMaterialExpressionTextureSampleParameter2D>(MatPtr);
-      BT->ParameterName = TEXT("BaseTexture");
-      MatPtr->GetExpressionCollection().AddExpression(BT);
+  if (Key.CollisionProfile == UCollisionProfile::NoCollision_ProfileName) {
+    HISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    HISM->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+  } else if (!Key.CollisionProfile.IsNone()) {
+    HISM->SetCollisionProfileName(Key.CollisionProfile);
+  }
 
-      // Create Tint Color Parameter
-      // (Default White)
-      auto TintColor = NewObject<UMaterialExpressionVectorParameter>(MatPtr);
-      TintColor->ParameterName = TEXT("TintColor");
-      TintColor->DefaultValue = FLinearColor::White;
-      MatPtr->GetExpressionCollection().AddExpression(TintColor);
+  if (Key.CullClass == ERoseCullClass::Grass) {
+    // Ground cover is too small to matter for navigation or DF lighting
+    HISM->SetCanEverAffectNavigation(false);
+    HISM->bAffectDistanceFieldLighting = false;
+  }
 
-      // Multiply Texture * Tint
-      auto Mult = NewObject<UMaterialExpressionMultiply>(MatPtr);
-      Mult->A.Expression = BT;
-      Mult->B.Expression = TintColor;
-      MatPtr->GetExpressionCollection().AddExpression(Mult);
+  const TArray<FRoseCullDistanceRule> &CullRules =
+      GetDefault<URoseImportSettings>()->CullDistanceRules;
+  if (CullRules.IsValidIndex(Key.CullRule)) {
+    HISM->InstanceStartCullDistance =
+        CullRules[Key.CullRule].StartCullDistance;
+    HISM->InstanceEndCullDistance = CullRules[Key.CullRule].EndCullDistance;
+  }
+  Report.CullRuleHISMs.FindOrAdd(Key.CullRule)++;
 
-#if WITH_EDITOR
-      MatPtr->GetEditorOnlyData()->BaseColor.Expression = Mult;
-      MatPtr->GetEditorOnlyData()->BaseColor.OutputIndex = 0;
+  GlobalHISMMap.Add(Key, HISM);
+  ZoneHISMs.Add(HISM);
+  return HISM;
+}
 
-      // Connect Alpha (Source is still
-      // Texture Alpha)
-      if (BlendMode == BLEND_Masked) {
+void FRoseImportReport::Log(const FString &ZoneName) const {
+  UE_LOG(LogRoseImporter, Log, TEXT("[Report] %s: %d HISMs, %d instances"),
+         *ZoneName, HISMCount, InstanceCount);
+  if (bIncremental) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   Incremental: %d tiles placed, %d kept; %d cells "
+                "rebuilt, %d kept; landscape %s"),
+           TilesRebuilt, TilesKept, CellsRebuilt, CellsKept,
+           bLandscapeRebuilt ? TEXT("rebuilt") : TEXT("kept"));
+  }
+  if (StaleAssetsRebuilt > 0) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   %d assets rebuilt from changed source files"),
+           StaleAssetsRebuilt);
+  }
+  UE_LOG(LogRoseImporter, Log,
+         TEXT("[Report]   %d animated objects, %d unique clips (%d clip "
+              "cache hits)"),
+         AnimatedCount, AnimClipCount, AnimClipCacheHits);
+  if (LODMeshCount > 0) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   %d meshes got %d LODs: %lld LOD0 triangles -> "
+                "%lld at the lowest LOD (%.0f%% saved)"),
+           LODMeshCount, LODLevelCount, LOD0Triangles, LowestLODTriangles,
+           100.0 * (1.0 - (double)LowestLODTriangles / LOD0Triangles));
+  }
+  UE_LOG(LogRoseImporter, Log,
+         TEXT("[Report]   %d mesh builds for %d meshes, %d material slot "
+              "updates on existing meshes"),
+         MeshBuildCount, BuiltMeshes.Num(), MeshMaterialUpdates);
+  if (MeshBuildCount != BuiltMeshes.Num()) {
+    UE_LOG(LogRoseImporter, Warning,
+           TEXT("[Report]   %d meshes were built more than once"),
+           MeshBuildCount - BuiltMeshes.Num());
+  }
+  if (PrefabInstanceCount > 0) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   %d prefab placements (%d new prefab meshes) "
+                "replaced %d part instances"),
+           PrefabInstanceCount, PrefabMeshCount,
+           PrefabInstanceCount + PrefabPartInstancesSaved);
+  }
+  if (bHLODLayerOnly) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   HLOD layer set on %d cell actors"),
+           HLODCellCount);
+  } else if (HLODCellCount > 0) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   %d HLOD proxies from %d HISMs, %lld proxy "
+                "triangles"),
+           HLODCellCount, HLODSourceHISMs, HLODTriangles);
+  }
+  if (WideIndexMeshCount > 0) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   %d merged meshes past 65535 vertices "
+                "(32-bit indices)"),
+           WideIndexMeshCount);
+  }
+  UE_LOG(LogRoseImporter, Log,
+         TEXT("[Report]   Lightmap UVs: %d generated, %d reused from ZMS UV2, "
+              "%d skipped"),
+         LightmapUVsGenerated, LightmapUVsReused, LightmapUVsSkipped);
+  UE_LOG(LogRoseImporter, Log,
+         TEXT("[Report]   Phases: hash %.2fs, landscape %.2fs, mesh builds "
+              "%.2fs, placement %.2fs, finalize %.2fs"),
+         HashSeconds, LandscapeSeconds, MeshBuildSeconds, PlacementSeconds,
+         FinalizeSeconds);
+  if (MeshOptimize.TrisBefore > 0) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   Mesh optimize: %d -> %d vertices, %d -> %d "
+                "triangles, ACMR %.3f -> %.3f (%.1f ms)"),
+           MeshOptimize.VertsBefore, MeshOptimize.VertsAfter,
+           MeshOptimize.TrisBefore, MeshOptimize.TrisAfter,
+           MeshOptimize.GetACMRBefore(), MeshOptimize.GetACMRAfter(),
+           MeshOptimize.Seconds * 1000.0);
+  }
+  if (MeshDescriptionCount > 0) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   Mesh descriptions: %d meshes, %d triangles in "
+                "%.1f ms (%.2f us per triangle)"),
+           MeshDescriptionCount, MeshDescriptionTris,
+           MeshDescriptionSeconds * 1000.0,
+           MeshDescriptionTris > 0
+               ? MeshDescriptionSeconds * 1e6 / MeshDescriptionTris
+               : 0.0);
+  }
+  for (const TPair<FName, int32> &Elem : CollisionCounts) {
+    UE_LOG(LogRoseImporter, Log, TEXT("[Report]   %d new meshes with %s "
+                                      "collision"),
+           Elem.Value, *Elem.Key.ToString());
+  }
+  if (NaniteMeshes.Num() > 0) {
+    UE_LOG(LogRoseImporter, Log, TEXT("[Report]   %d Nanite meshes: %s"),
+           NaniteMeshes.Num(), *FString::Join(NaniteMeshes, TEXT(", ")));
+  }
+  if (AnimBakedCount > 0) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   %d animated objects baked to WPO"),
+           AnimBakedCount);
+  }
+
+  // Cull rule preview: which rules matched and how much they cover
+  const TArray<FRoseCullDistanceRule> &CullRules =
+      GetDefault<URoseImportSettings>()->CullDistanceRules;
+  for (int32 i = INDEX_NONE; i < CullRules.Num(); ++i) {
+    const int32 *NumHISMs = CullRuleHISMs.Find(i);
+    const int32 *NumInstances = CullRuleInstances.Find(i);
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[Report]   Cull rule %s: %d HISMs, %d instances"),
+           CullRules.IsValidIndex(i)
+               ? *FString::Printf(TEXT("%d (%s)"), i, *CullRules[i].Describe())
+               : TEXT("none (never culled)"),
+           NumHISMs ? *NumHISMs : 0, NumInstances ? *NumInstances : 0);
+  }
+}
+
+FIntPoint URoseImporter::GetPartitionCell(const FRoseMapObject &MapObj,
+                                          const FVector &Location) const {
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+  switch (Settings->HISMPartition) {
+  case ERoseHISMPartition::Tile:
+    return FIntPoint(MapObj.MapPosition.X, MapObj.MapPosition.Y);
+  case ERoseHISMPartition::Cell: {
+    const double CellSize = FMath::Max(1.0f, Settings->PartitionCellSize);
+    return FIntPoint(FMath::FloorToInt32(Location.X / CellSize),
+                     FMath::FloorToInt32(Location.Y / CellSize));
+  }
+  default:
+    return FIntPoint::ZeroValue;
+  }
+}
+
+AActor *URoseImporter::GetHISMOwner(const FIntPoint &Cell) {
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+  if (!ZoneObjectsActor ||
+      Settings->HISMPartition == ERoseHISMPartition::None ||
+      !Settings->bSpawnPartitionActors) {
+    return ZoneObjectsActor;
+  }
+  if (AActor **Found = PartitionActors.Find(Cell)) {
+    return *Found;
+  }
+
+  UWorld *World = ZoneObjectsActor->GetWorld();
+  FActorSpawnParameters SpawnParams;
+  SpawnParams.SpawnCollisionHandlingOverride =
+      ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+  AActor *CellActor =
+      World->SpawnActor<AActor>(AActor::StaticClass(), FVector::ZeroVector,
+                                FRotator::ZeroRotator, SpawnParams);
+  if (!CellActor) {
+    UE_LOG(LogRoseImporter, Warning,
+           TEXT("[HISM] Failed to spawn cell actor (%d, %d), using zone "
+                "actor"),
+           Cell.X, Cell.Y);
+    return ZoneObjectsActor;
+  }
+
+  // Instances are stored in world space, so the actor stays at the origin;
+  // its streaming bounds come from the HISMs it owns
+  USceneComponent *CellRoot =
+      NewObject<USceneComponent>(CellActor, TEXT("CellRoot"));
+  CellRoot->SetMobility(EComponentMobility::Static);
+  CellActor->SetRootComponent(CellRoot);
+  CellRoot->RegisterComponent();
+
+  CellActor->SetActorLabel(FString::Printf(
+      TEXT("ZoneObjects_%s_%d_%d"), *CurrentZoneName, Cell.X, Cell.Y));
+  CellActor->Tags.Add(FName(*(TEXT("RoseZone_") + CurrentZoneName)));
+  CellActor->Tags.Add(MakeRoseCellTag(Cell));
+
+#if WITH_EDITOR
+  CellActor->SetFolderPath(
+      FName(*(TEXT("Rose/") + CurrentZoneName + TEXT("/Cells"))));
+  CellActor->SetIsSpatiallyLoaded(true);
+#endif
+
+  PartitionActors.Add(Cell, CellActor);
+  return CellActor;
+}
+
+UHLODLayer *URoseImporter::GetOrCreateHLODLayer() {
+  if (UHLODLayer *Layer =
+          GetDefault<URoseImportSettings>()->HLODLayer.LoadSynchronous()) {
+    return Layer;
+  }
+
+  const FString AssetName = TEXT("HLOD_RoseZoneObjects");
+  const FString PackageName = TEXT("/Game/Rose/Imported/HLOD/") + AssetName;
+  if (UHLODLayer *Existing = LoadObject<UHLODLayer>(
+          nullptr, *(PackageName + TEXT(".") + AssetName))) {
+    return Existing;
+  }
+
+  UPackage *Package = CreatePackage(*PackageName);
+  UHLODLayer *Layer =
+      NewObject<UHLODLayer>(Package, *AssetName, RF_Public | RF_Standalone);
+  // Simplified merge with baked materials: one draw per cell
+  Layer->SetLayerType(EHLODLayerType::MeshSimplify);
+  FAssetRegistryModule::AssetCreated(Layer);
+  SaveRoseAsset(Layer);
+  return Layer;
+}
+
+void URoseImporter::BuildZoneHLODs(UWorld *World) {
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+  if (!Settings->bGenerateHLODs || !World)
+    return;
+  if (PartitionActors.Num() == 0) {
+    UE_LOG(LogRoseImporter, Warning,
+           TEXT("[HLOD] Needs partition cell actors (HISMPartition and "
+                "bSpawnPartitionActors), skipped"));
+    return;
+  }
+
+  // World Partition generates HLOD actors from the layer on each actor
+  if (World->IsPartitionedWorld()) {
+    UHLODLayer *Layer = GetOrCreateHLODLayer();
+    for (const TPair<FIntPoint, AActor *> &Elem : PartitionActors) {
+      Elem.Value->SetHLODLayer(Layer);
+    }
+    Report.HLODCellCount = PartitionActors.Num();
+    Report.bHLODLayerOnly = true;
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[HLOD] Layer %s set on %d cell actors; use Build > Build "
+                "HLODs to generate the proxies"),
+           *Layer->GetName(), PartitionActors.Num());
+    return;
+  }
+
+  // Otherwise each cell is merged into one proxy mesh, swapped in by an
+  // ALODActor beyond HLODDrawDistance
+  TMap<AActor *, TArray<UPrimitiveComponent *>> CellComponents;
+  for (UHierarchicalInstancedStaticMeshComponent *HISM : ZoneHISMs) {
+    if (!HISM || HISM->GetInstanceCount() == 0)
+      continue;
+    // Already culled where the proxy takes over
+    if (HISM->InstanceEndCullDistance > 0 &&
+        HISM->InstanceEndCullDistance < Settings->HLODDrawDistance)
+      continue;
+    CellComponents.FindOrAdd(HISM->GetOwner()).Add(HISM);
+  }
+
+  const IMeshMergeUtilities &MergeUtilities =
+      FModuleManager::Get()
+          .LoadModuleChecked<IMeshMergeModule>("MeshMergeUtilities")
+          .GetUtilities();
+  FMeshMergingSettings MergeSettings;
+  // Lowest generated LOD as the simplified source, textures baked into
+  // one material per proxy
+  MergeSettings.LODSelectionType = EMeshLODSelectionType::LowestDetailLOD;
+  MergeSettings.bMergeMaterials = true;
+  MergeSettings.bMergePhysicsData = false;
+
+  FScopedSlowTask SlowTask(PartitionActors.Num(),
+                           NSLOCTEXT("RoseImporter", "BuildingHLODs",
+                                     "Building HLOD proxies..."));
+  for (const TPair<FIntPoint, AActor *> &Elem : PartitionActors) {
+    SlowTask.EnterProgressFrame();
+    const TArray<UPrimitiveComponent *> *Components =
+        CellComponents.Find(Elem.Value);
+    if (!Components)
+      continue;
+
+    const FString AssetName = FString::Printf(
+        TEXT("HLOD_%s_%d_%d"), *CurrentZoneName, Elem.Key.X, Elem.Key.Y);
+    TArray<UObject *> CreatedAssets;
+    FVector ProxyLocation = FVector::ZeroVector;
+    MergeUtilities.MergeComponentsToStaticMesh(
+        *Components, World, MergeSettings, nullptr, nullptr,
+        TEXT("/Game/Rose/Imported/HLOD/") + CurrentZoneName + TEXT("/") +
+            AssetName,
+        CreatedAssets, ProxyLocation, /*ScreenAreaSize=*/1.0f,
+        /*bSilent=*/true);
+
+    UStaticMesh *ProxyMesh = nullptr;
+    for (UObject *Asset : CreatedAssets) {
+      if (UStaticMesh *Mesh = Cast<UStaticMesh>(Asset)) {
+        ProxyMesh = Mesh;
+      }
+      SaveRoseAsset(Asset);
+    }
+    if (!ProxyMesh) {
+      UE_LOG(LogRoseImporter, Warning, TEXT("[HLOD] Merge failed for %s"),
+             *AssetName);
+      continue;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride =
+        ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    ALODActor *LODActor = World->SpawnActor<ALODActor>(
+        ProxyLocation, FRotator::ZeroRotator, SpawnParams);
+    if (!LODActor)
+      continue;
+    LODActor->SetStaticMesh(ProxyMesh);
+    LODActor->AddSubActor(Elem.Value);
+    LODActor->SetDrawDistance(Settings->HLODDrawDistance);
+    LODActor->SetActorLabel(AssetName);
+    LODActor->Tags.Add(FName(*(TEXT("RoseZone_") + CurrentZoneName)));
+    LODActor->Tags.Add(MakeRoseCellTag(Elem.Key));
+#if WITH_EDITOR
+    LODActor->SetFolderPath(
+        FName(*(TEXT("Rose/") + CurrentZoneName + TEXT("/HLOD"))));
+#endif
+
+    Report.HLODCellCount++;
+    Report.HLODSourceHISMs += Components->Num();
+    if (ProxyMesh->GetRenderData() &&
+        ProxyMesh->GetRenderData()->LODResources.Num() > 0) {
+      const FStaticMeshLODResources &ProxyLOD =
+          ProxyMesh->GetRenderData()->LODResources[0];
+      Report.HLODTriangles += ProxyLOD.GetNumTriangles();
+      if (ProxyLOD.IndexBuffer.Is32Bit()) {
+        Report.WideIndexMeshCount++;
+      }
+    }
+  }
+}
+
+void URoseImporter::QueueHISMInstance(
+    UHierarchicalInstancedStaticMeshComponent *HISM,
+    const FTransform &Transform, TConstArrayView<float> CustomData) {
+  if (!HISM)
+    return;
+  PendingHISMInstances.FindOrAdd(HISM).Add(Transform);
+  if (CustomData.Num() > 0) {
+    PendingHISMCustomData.FindOrAdd(HISM).Append(CustomData);
+  }
+}
+
+void SortInstancesByMorton(TArray<FTransform> &Transforms,
+                           TArray<float> *CustomData) {
+  if (Transforms.Num() < 3)
+    return;
+
+  FBox2D Bounds(ForceInit);
+  for (const FTransform &T : Transforms) {
+    Bounds += FVector2D(T.GetLocation());
+  }
+  const FVector2D Extent = Bounds.GetSize();
+  const double ScaleX = Extent.X > 0.0 ? 65535.0 / Extent.X : 0.0;
+  const double ScaleY = Extent.Y > 0.0 ? 65535.0 / Extent.Y : 0.0;
+
+  TArray<TPair<uint32, int32>> Codes;
+  Codes.SetNumUninitialized(Transforms.Num());
+  for (int32 i = 0; i < Transforms.Num(); ++i) {
+    const FVector Loc = Transforms[i].GetLocation();
+    const uint32 QX = (uint32)((Loc.X - Bounds.Min.X) * ScaleX);
+    const uint32 QY = (uint32)((Loc.Y - Bounds.Min.Y) * ScaleY);
+    Codes[i] = {FMath::MortonCode2(QX) | (FMath::MortonCode2(QY) << 1), i};
+  }
+  // Stable so co-located instances keep their file order
+  Algo::StableSortBy(Codes,
+                     [](const TPair<uint32, int32> &C) { return C.Key; });
+
+  TArray<FTransform> Sorted;
+  Sorted.Reserve(Transforms.Num());
+  for (const TPair<uint32, int32> &C : Codes) {
+    Sorted.Add(Transforms[C.Value]);
+  }
+
+  // Custom data that does not split evenly per instance is left as it is
+  if (CustomData && CustomData->Num() > 0 &&
+      CustomData->Num() % Transforms.Num() == 0) {
+    const int32 Stride = CustomData->Num() / Transforms.Num();
+    TArray<float> SortedData;
+    SortedData.Reserve(CustomData->Num());
+    for (const TPair<uint32, int32> &C : Codes) {
+      SortedData.Append(&(*CustomData)[C.Value * Stride], Stride);
+    }
+    *CustomData = MoveTemp(SortedData);
+  }
+  Transforms = MoveTemp(Sorted);
+}
+
+// Mean distance between consecutive instances, a cheap locality measure
+static double MeanInstanceStep(const TArray<FTransform> &Transforms) {
+  if (Transforms.Num() < 2)
+    return 0.0;
+  double Sum = 0.0;
+  for (int32 i = 1; i < Transforms.Num(); ++i) {
+    Sum += FVector::Dist(Transforms[i - 1].GetLocation(),
+                         Transforms[i].GetLocation());
+  }
+  return Sum / (Transforms.Num() - 1);
+}
+
+// Cluster tree cost of one instance order, summed over HISMs
+struct FRoseClusterBench {
+  double BuildSeconds = 0.0;
+  // Instances in leaf clusters touching a probe, i.e. kept by culling
+  int64 InstancesKept = 0;
+};
+
+// Builds the cluster tree the HISM would build from Transforms and counts
+// the instances its leaves keep for each probe sphere. Probes are the same
+// for both orders, so the kept counts compare directly.
+static void BenchmarkClusterTree(const TArray<FTransform> &Transforms,
+                                 const FBox &MeshBox, int32 MaxPerLeaf,
+                                 TConstArrayView<FVector> Probes,
+                                 double ProbeRadius, FRoseClusterBench &Out) {
+  TArray<FMatrix> Matrices;
+  Matrices.Reserve(Transforms.Num());
+  for (const FTransform &T : Transforms) {
+    Matrices.Add(T.ToMatrixWithScale());
+  }
+  TArray<float> NoCustomData;
+  TArray<FClusterNode> Tree;
+  TArray<int32> SortedInstances;
+  TArray<int32> ReorderTable;
+  int32 OcclusionLayers = 0;
+  const double Start = FPlatformTime::Seconds();
+  UHierarchicalInstancedStaticMeshComponent::BuildTreeAnyThread(
+      Matrices, NoCustomData, 0, MeshBox, Tree, SortedInstances, ReorderTable,
+      OcclusionLayers, MaxPerLeaf, false);
+  Out.BuildSeconds += FPlatformTime::Seconds() - Start;
+
+  TArray<int32, TInlineAllocator<64>> Stack;
+  for (const FVector &Probe : Probes) {
+    Stack.Reset();
+    if (Tree.Num() > 0) {
+      Stack.Add(0);
+    }
+    while (Stack.Num() > 0) {
+      const FClusterNode &Node = Tree[Stack.Pop(EAllowShrinking::No)];
+      const FBox NodeBox(FVector(Node.BoundMin), FVector(Node.BoundMax));
+      if (!FMath::SphereAABBIntersection(Probe, FMath::Square(ProbeRadius),
+                                         NodeBox))
+        continue;
+      if (Node.FirstChild < 0) {
+        Out.InstancesKept += Node.LastInstance - Node.FirstInstance + 1;
+      } else {
+        for (int32 Child = Node.FirstChild; Child <= Node.LastChild; ++Child) {
+          Stack.Add(Child);
+        }
+      }
+    }
+  }
+}
+
+void URoseImporter::FlushHISMInstances() {
+  const double StartTime = FPlatformTime::Seconds();
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+  const bool bMortonSort = Settings->bSortInstances;
+  const bool bBenchmark = bMortonSort && Settings->bBenchmarkInstanceSort;
+  int32 TotalInstances = 0;
+  double SortTime = 0.0;
+  double StepBefore = 0.0, StepAfter = 0.0;
+  FRoseClusterBench BenchFileOrder, BenchSorted;
+  int64 BenchInside = 0;
+  int32 BenchProbes = 0;
+
+  for (auto &Elem : PendingHISMInstances) {
+    UHierarchicalInstancedStaticMeshComponent *HISM = Elem.Key;
+    if (!IsValid(HISM) || Elem.Value.Num() == 0)
+      continue;
+
+    TArray<float> *CustomData = PendingHISMCustomData.Find(HISM);
+
+    // Probes: up to 64 instance positions, radius of the cull distance
+    TArray<FVector> Probes;
+    double ProbeRadius = 0.0;
+    FBox MeshBox(ForceInit);
+    if (bBenchmark && HISM->GetStaticMesh() && Elem.Value.Num() >= 3) {
+      const int32 Step = FMath::Max(1, Elem.Value.Num() / 64);
+      for (int32 i = 0; i < Elem.Value.Num(); i += Step) {
+        Probes.Add(Elem.Value[i].GetLocation());
+      }
+      ProbeRadius = HISM->InstanceEndCullDistance > 0
+                        ? (double)HISM->InstanceEndCullDistance
+                        : 10000.0;
+      MeshBox = HISM->GetStaticMesh()->GetBounds().GetBox();
+      BenchmarkClusterTree(Elem.Value, MeshBox, HISM->DesiredInstancesPerLeaf(),
+                           Probes, ProbeRadius, BenchFileOrder);
+      for (const FVector &Probe : Probes) {
+        for (const FTransform &T : Elem.Value) {
+          BenchInside += FVector::DistSquared(T.GetLocation(), Probe) <=
+                         FMath::Square(ProbeRadius);
+        }
+      }
+      BenchProbes += Probes.Num();
+    }
+
+    if (bMortonSort) {
+      const double SortStart = FPlatformTime::Seconds();
+      StepBefore += MeanInstanceStep(Elem.Value) * Elem.Value.Num();
+      SortInstancesByMorton(Elem.Value, CustomData);
+      StepAfter += MeanInstanceStep(Elem.Value) * Elem.Value.Num();
+      SortTime += FPlatformTime::Seconds() - SortStart;
+    }
+    if (Probes.Num() > 0) {
+      BenchmarkClusterTree(Elem.Value, MeshBox, HISM->DesiredInstancesPerLeaf(),
+                           Probes, ProbeRadius, BenchSorted);
+    }
+
+    // Suppress the per-change rebuild, then build the cluster tree once
+    HISM->bAutoRebuildTreeOnInstanceChanges = false;
+    const int32 FirstIndex = HISM->GetInstanceCount();
+    HISM->AddInstances(Elem.Value, /*bShouldReturnIndices=*/false);
+    const int32 Stride = HISM->NumCustomDataFloats;
+    if (Stride > 0 && CustomData &&
+        CustomData->Num() == Elem.Value.Num() * Stride) {
+      for (int32 i = 0; i < Elem.Value.Num(); ++i) {
+        HISM->SetCustomData(FirstIndex + i,
+                            MakeArrayView(&(*CustomData)[i * Stride], Stride));
+      }
+    }
+    HISM->bAutoRebuildTreeOnInstanceChanges = true;
+    HISM->BuildTreeIfOutdated(/*Async=*/true, /*ForceUpdate=*/true);
+
+    TotalInstances += Elem.Value.Num();
+  }
+
+  UE_LOG(LogRoseImporter, Log,
+         TEXT("[HISM] Added %d instances to %d components in %.2fs "
+              "(cluster trees building async)"),
+         TotalInstances, PendingHISMInstances.Num(),
+         FPlatformTime::Seconds() - StartTime);
+  if (bMortonSort && TotalInstances > 0) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[HISM] Morton sort took %.3fs, mean instance step %.0f -> "
+                "%.0f cm"),
+           SortTime, StepBefore / TotalInstances, StepAfter / TotalInstances);
+  }
+  if (BenchProbes > 0) {
+    UE_LOG(LogRoseImporter, Log,
+           TEXT("[HISM] Sort benchmark: cluster trees %.3fs -> %.3fs, "
+                "instances kept by cluster culling %lld -> %lld over %d "
+                "probes (%lld actually in range)"),
+           BenchFileOrder.BuildSeconds, BenchSorted.BuildSeconds,
+           BenchFileOrder.InstancesKept, BenchSorted.InstancesKept,
+           BenchProbes, BenchInside);
+  }
+
+  PendingHISMInstances.Empty();
+  PendingHISMCustomData.Empty();
+}
+
+// Custom node body for AddRoseAnimWPOExpressions. Samples the baked clip
+// (see FRoseAnimClip::Bake) and returns the local-space vertex offset.
+static const TCHAR *RoseAnimWPOCode = TEXT(R"(
+if (Frames < 1 || FPS <= 0)
+  return float3(0, 0, 0);
+float T = frac((Time + Phase) * FPS / Frames) * Frames;
+float F0 = min(floor(T), Frames - 1);
+float F1 = min(F0 + 1, Frames - 1);
+float A = T - floor(T);
+float U0 = (F0 + 0.5) / Frames;
+float U1 = (F1 + 0.5) / Frames;
+float3 P = lerp(Tex.SampleLevel(TexSampler, float2(U0, 0.5 / 3), 0).xyz,
+                Tex.SampleLevel(TexSampler, float2(U1, 0.5 / 3), 0).xyz, A);
+float4 Q0 = Tex.SampleLevel(TexSampler, float2(U0, 1.5 / 3), 0);
+float4 Q1 = Tex.SampleLevel(TexSampler, float2(U1, 1.5 / 3), 0);
+Q1 = dot(Q0, Q1) < 0 ? -Q1 : Q1;
+float4 Q = normalize(lerp(Q0, Q1, A));
+float3 S = lerp(Tex.SampleLevel(TexSampler, float2(U0, 2.5 / 3), 0).xyz,
+                Tex.SampleLevel(TexSampler, float2(U1, 2.5 / 3), 0).xyz, A);
+float3 V = LocalPos * S;
+V += 2.0 * cross(Q.xyz, cross(Q.xyz, V) + Q.w * V);
+return V + P - LocalPos;
+)");
+
+// Builds the rigid vertex animation graph: custom data 0-2 carry phase,
+// frame count and FPS, AnimTex holds the baked clip. Returns the world
+// space offset to plug into World Position Offset.
+static UMaterialExpression *AddRoseAnimWPOExpressions(UMaterial *Mat,
+                                                      UTexture *DefaultTex) {
+  auto AddInput = [](UMaterialExpressionCustom *Custom, const TCHAR *Name,
+                     UMaterialExpression *Expr) {
+    FCustomInput &In = Custom->Inputs.AddDefaulted_GetRef();
+    In.InputName = Name;
+    In.Input.Expression = Expr;
+  };
+  auto CustomData = [Mat](int32 Index) {
+    auto Data = NewObject<UMaterialExpressionPerInstanceCustomData>(Mat);
+    Data->DataIndex = Index;
+    Mat->GetExpressionCollection().AddExpression(Data);
+    return Data;
+  };
+
+  auto AnimTex = NewObject<UMaterialExpressionTextureObjectParameter>(Mat);
+  AnimTex->ParameterName = TEXT("AnimTex");
+  AnimTex->Texture = DefaultTex;
+  AnimTex->SamplerType = SAMPLERTYPE_LinearColor;
+  Mat->GetExpressionCollection().AddExpression(AnimTex);
+
+  auto LocalPos = NewObject<UMaterialExpressionPreSkinnedPosition>(Mat);
+  Mat->GetExpressionCollection().AddExpression(LocalPos);
+
+  auto Time = NewObject<UMaterialExpressionTime>(Mat);
+  Mat->GetExpressionCollection().AddExpression(Time);
+
+  auto Custom = NewObject<UMaterialExpressionCustom>(Mat);
+  Custom->Description = TEXT("RoseRigidAnim");
+  Custom->OutputType = CMOT_Float3;
+  Custom->Code = RoseAnimWPOCode;
+  Custom->Inputs.Empty();
+  AddInput(Custom, TEXT("Tex"), AnimTex);
+  AddInput(Custom, TEXT("LocalPos"), LocalPos);
+  AddInput(Custom, TEXT("Time"), Time);
+  AddInput(Custom, TEXT("Phase"), CustomData(0));
+  AddInput(Custom, TEXT("Frames"), CustomData(1));
+  AddInput(Custom, TEXT("FPS"), CustomData(2));
+  Mat->GetExpressionCollection().AddExpression(Custom);
+
+  // Local offset -> world, including the instance rotation and scale
+  auto ToWorld = NewObject<UMaterialExpressionTransform>(Mat);
+  ToWorld->Input.Expression = Custom;
+  ToWorld->TransformSourceType = TRANSFORMSOURCE_Local;
+  ToWorld->TransformType = TRANSFORM_World;
+  Mat->GetExpressionCollection().AddExpression(ToWorld);
+  return ToWorld;
+}
+
+void URoseImporter::EnsureMasterMaterial() {
+  auto EnsureVariant = [&](UMaterial *&MatPtr, const FString &Name,
+                           EBlendMode BlendMode, bool bAnimWPO) {
+    // Already checked (and built if needed) in this editor session
+    if (UMaterial *Verified = GetSession().FindMasterMaterial(Name)) {
+      MatPtr = Verified;
+      return;
+    }
+
+    FString PN = TEXT("/Game/Rose/Materials/") + Name;
+    // Always try to load first
+    if (!MatPtr)
+      MatPtr = Cast<UMaterial>(FSoftObjectPath(PN).TryLoad());
+
+    bool bNeedsBuild = false;
+
+    // If not found, create it
+    if (!MatPtr) {
+      UE_LOG(LogRoseImporter, Log,
+             TEXT("[Material] Creating new "
+                  "master material: %s"),
+             *Name);
+      UPackage *P = CreatePackage(*PN);
+      MatPtr = (UMaterial *)NewObject<UMaterialFactoryNew>()->FactoryCreateNew(
+          UMaterial::StaticClass(), P, *Name, RF_Public | RF_Standalone,
+          nullptr, GWarn);
+      bNeedsBuild = true;
+    } else {
+      // Only rebuild if empty (check if
+      // expressions exist)
+      if (MatPtr->GetExpressionCollection().Expressions.Num() == 0) {
+        bNeedsBuild = true;
+      }
+    }
+
+    // Only update content if needed
+    // (Prevents constant
+    // Saving/Rebuilding)
+    if (MatPtr && bNeedsBuild) {
+      // Clear existing expressions to
+      // rebuild clean
+      MatPtr->GetExpressionCollection().Empty();
+
+      auto BT = NewObject<UMaterialExpressionTextureSampleParameter2D>(MatPtr);
+      BT->ParameterName = TEXT("BaseTexture");
+      MatPtr->GetExpressionCollection().AddExpression(BT);
+
+      // Create Tint Color Parameter
+      // (Default White)
+      auto TintColor = NewObject<UMaterialExpressionVectorParameter>(MatPtr);
+      TintColor->ParameterName = TEXT("TintColor");
+      TintColor->DefaultValue = FLinearColor::White;
+      MatPtr->GetExpressionCollection().AddExpression(TintColor);
+
+      // Multiply Texture * Tint
+      auto Mult = NewObject<UMaterialExpressionMultiply>(MatPtr);
+      Mult->A.Expression = BT;
+      Mult->B.Expression = TintColor;
+      MatPtr->GetExpressionCollection().AddExpression(Mult);
+
+#if WITH_EDITOR
+      MatPtr->GetEditorOnlyData()->BaseColor.Expression = Mult;
+      MatPtr->GetEditorOnlyData()->BaseColor.OutputIndex = 0;
+
+      // Connect Alpha (Source is still
+      // Texture Alpha)
+      if (BlendMode == BLEND_Masked) {
         MatPtr->GetEditorOnlyData()->OpacityMask.Expression = BT;
         MatPtr->GetEditorOnlyData()->OpacityMask.OutputIndex = 4; // Alpha
       } else if (BlendMode == BLEND_Translucent) {
         MatPtr->GetEditorOnlyData()->Opacity.Expression = BT;
         MatPtr->GetEditorOnlyData()->Opacity.OutputIndex = 4; // Alpha
       }
+
+      if (bAnimWPO) {
+        MatPtr->GetEditorOnlyData()->WorldPositionOffset.Expression =
+            AddRoseAnimWPOExpressions(
+                MatPtr, CreateAnimBakeTexture(TEXT("T_RoseAnimIdentity"),
+                                              FRoseAnimClip()));
+      }
 #endif
 
       MatPtr->BlendMode = BlendMode;
@@ -2141,36 +3471,135 @@ void URoseImporter::EnsureMasterMaterial() {
                   "existing material: %s"),
              *Name);
     }
+    if (MatPtr) {
+      GetSession().AddMasterMaterial(Name, MatPtr);
+    }
   };
 
-  EnsureVariant(MasterMaterial, TEXT("M_RoseMaster"), BLEND_Opaque);
+  EnsureVariant(MasterMaterial, TEXT("M_RoseMaster"), BLEND_Opaque, false);
   EnsureVariant(MasterMaterial_Masked, TEXT("M_RoseMaster_Masked"),
-                BLEND_Masked);
+                BLEND_Masked, false);
   EnsureVariant(MasterMaterial_Translucent, TEXT("M_RoseMaster_Translucent"),
-                BLEND_Translucent);
+                BLEND_Translucent, false);
+
+  if (GetDefault<URoseImportSettings>()->bBakeAnimatedObjectsToWPO) {
+    EnsureVariant(MasterMaterial_AnimWPO, TEXT("M_RoseMaster_AnimWPO"),
+                  BLEND_Opaque, true);
+    EnsureVariant(MasterMaterial_Masked_AnimWPO,
+                  TEXT("M_RoseMaster_Masked_AnimWPO"), BLEND_Masked, true);
+    EnsureVariant(MasterMaterial_Translucent_AnimWPO,
+                  TEXT("M_RoseMaster_Translucent_AnimWPO"), BLEND_Translucent,
+                  true);
+  }
 }
 
-UTexture2D *URoseImporter::LoadRoseTexture(const FString &RP) {
-  // Fast in-memory cache check
-  if (UTexture2D **Cached = TextureCache.Find(RP)) {
-    return *Cached;
+UTexture2D *URoseImporter::CreateAnimBakeTexture(const FString &AssetName,
+                                                 const FRoseAnimClip &Clip) {
+  FString PackageName = TEXT("/Game/Rose/Imported/AnimBakes/") + AssetName;
+
+  TArray<FLinearColor> Pixels;
+  Clip.Bake(Pixels);
+  const int32 Width = Pixels.Num() / 3;
+
+  TArray<FFloat16Color> HalfPixels;
+  HalfPixels.Reserve(Pixels.Num());
+  for (const FLinearColor &P : Pixels) {
+    HalfPixels.Add(FFloat16Color(P));
   }
 
-  FString AB = FPaths::GetBaseFilename(RP);
-  FString PN = TEXT("/Game/Rose/Imported/"
-                    "Textures/") +
-               AB;
+  UTexture2D *Tex = LoadObject<UTexture2D>(nullptr, *PackageName, nullptr,
+                                           LOAD_NoWarn | LOAD_Quiet);
+  if (Tex && Tex->Source.GetSizeX() == Width && Tex->Source.GetSizeY() == 3 &&
+      Tex->Source.GetFormat() == TSF_RGBA16F) {
+    // Same clip as the saved texture: leave the asset and its package alone
+    TArray64<uint8> Existing;
+    const int64 NumBytes = HalfPixels.Num() * sizeof(FFloat16Color);
+    if (Tex->Source.GetMipData(Existing, 0, 0, 0) &&
+        Existing.Num() == NumBytes &&
+        FMemory::Memcmp(Existing.GetData(), HalfPixels.GetData(), NumBytes) ==
+            0) {
+      return Tex;
+    }
+  }
+  if (!Tex) {
+    UPackage *Package = CreatePackage(*PackageName);
+    Tex = NewObject<UTexture2D>(Package, *AssetName, RF_Public | RF_Standalone);
+    FAssetRegistryModule::AssetCreated(Tex);
+  }
 
-  // Check if texture already loaded in
-  // UE
-  UTexture2D *Existing =
-      FindObject<UTexture2D>(nullptr, *(PN + TEXT(".") + AB));
-  if (Existing) {
-    TextureCache.Add(RP, Existing);
-    return Existing;
+  // Exact keys: uncompressed half floats, no filtering or mips
+  Tex->Source.Init(Width, 3, 1, 1, TSF_RGBA16F,
+                   (const uint8 *)HalfPixels.GetData());
+  Tex->CompressionSettings = TC_HDR;
+  Tex->SRGB = false;
+  Tex->Filter = TF_Nearest;
+  Tex->MipGenSettings = TMGS_NoMipmaps;
+  Tex->LODGroup = TEXTUREGROUP_16BitData;
+  Tex->NeverStream = true;
+  Tex->PostEditChange();
+
+  // Queued for the end-of-import save batch
+  SaveRoseAsset(Tex);
+  return Tex;
+}
+
+UMaterialInterface *
+URoseImporter::GetOrCreateAnimWPOMaterial(const FRoseZSC::FMaterialEntry *M,
+                                          UTexture2D *AnimTex) {
+  // Material settings come from the per-ZSC-material parent; this instance
+  // only adds the clip
+  UMaterialInterface *Parent = GetOrCreateMeshMaterial(M, /*bAnimWPO=*/true);
+  if (!Parent) {
+    EnsureMasterMaterial();
+    Parent = MasterMaterial_AnimWPO;
+  }
+  if (!Parent || !AnimTex)
+    return nullptr;
+
+  const FString Name = Parent->GetName() + TEXT("_") + AnimTex->GetName();
+  const FString PackageName = TEXT("/Game/Rose/Imported/Materials/") + Name;
+  const FString FullName = PackageName + TEXT(".") + Name;
+
+  if (UMaterialInstanceConstant *Cached =
+          GetSession().FindMaterialInstance(PackageName)) {
+    return Cached;
+  }
+  UMaterialInstanceConstant *MIC =
+      FindObject<UMaterialInstanceConstant>(nullptr, *FullName);
+  if (!MIC) {
+    MIC = LoadObject<UMaterialInstanceConstant>(nullptr, *FullName, nullptr,
+                                                LOAD_NoWarn | LOAD_Quiet);
+  }
+  if (!MIC) {
+    UPackage *MatPkg = CreatePackage(*PackageName);
+    MatPkg->FullyLoad();
+    auto MatFactory = NewObject<UMaterialInstanceConstantFactoryNew>();
+    MIC = (UMaterialInstanceConstant *)MatFactory->FactoryCreateNew(
+        UMaterialInstanceConstant::StaticClass(), MatPkg, *Name,
+        RF_Public | RF_Standalone, nullptr, GWarn);
+  }
+  if (!MIC)
+    return nullptr;
+
+  MIC->SetParentEditorOnly(Parent);
+  MIC->SetTextureParameterValueEditorOnly(
+      FMaterialParameterInfo(TEXT("AnimTex")), AnimTex);
+  MIC->PostEditChange();
+  SaveRoseAsset(MIC);
+
+  GetSession().AddMaterialInstance(PackageName, MIC);
+  return MIC;
+}
+
+FString URoseImporter::ResolveRoseTexturePath(const FString &RP) const {
+  // Probing the search prefixes costs dozens of file system queries, so
+  // results are kept in the session's path index
+  FString AP;
+  if (Session && Session->FindTexturePath(RP, AP)) {
+    return AP;
   }
 
-  FString AP = RP;
+  AP = RP;
   bool bFound = false;
 
   // 1. Check if the path is absolute and exists
@@ -2234,6 +3663,44 @@ UTexture2D *URoseImporter::LoadRoseTexture(const FString &RP) {
     }
   }
 
+  if (!bFound) {
+    AP.Empty();
+  }
+  if (Session) {
+    Session->AddTexturePath(RP, AP);
+  }
+  return AP;
+}
+
+UTexture2D *URoseImporter::LoadRoseTexture(const FString &RP) {
+  FString AB = FPaths::GetBaseFilename(RP);
+  FString PN = TEXT("/Game/Rose/Imported/"
+                    "Textures/") +
+               AB;
+
+  // A changed source file is imported again, once per import
+  const bool bStale = StaleSourceFiles.Num() > 0 &&
+                      IsStaleAsset(ResolveRoseTexturePath(RP), PN);
+
+  if (!bStale) {
+    // Fast in-memory cache check
+    if (UTexture2D *Cached = GetSession().FindTexture(RP)) {
+      return Cached;
+    }
+
+    // Check if texture already loaded in
+    // UE
+    UTexture2D *Existing =
+        FindObject<UTexture2D>(nullptr, *(PN + TEXT(".") + AB));
+    if (Existing) {
+      GetSession().AddTexture(RP, Existing);
+      return Existing;
+    }
+  }
+
+  FString AP = ResolveRoseTexturePath(RP);
+  const bool bFound = !AP.IsEmpty();
+
   UE_LOG(LogRoseImporter, Log,
          TEXT("Attempting to load texture: %s -> Resolved: %s (Found: %d)"),
          *RP, *AP, bFound);
@@ -2381,7 +3848,7 @@ UTexture2D *URoseImporter::LoadRoseTexture(const FString &RP) {
         ImportTask->DestinationPath = TEXT("/Game/Rose/Imported/"
                                            "Textures");
         ImportTask->DestinationName = AB;
-        ImportTask->bSave = true;
+        ImportTask->bSave = false; // Saved with the import batch
         ImportTask->bAutomated = true;
         ImportTask->bReplaceExisting = true;
         ImportTask->Factory = TextureFactory;
@@ -2403,7 +3870,9 @@ UTexture2D *URoseImporter::LoadRoseTexture(const FString &RP) {
                         "imported via "
                         "factory: %s"),
                    *AB);
-            TextureCache.Add(RP, ImportedTexture);
+            SaveRoseAsset(ImportedTexture);
+            GetSession().AddTexture(RP, ImportedTexture);
+            RefreshedAssets.Add(PN);
             return ImportedTexture;
           }
         }
@@ -2674,56 +4143,97 @@ UStaticMesh *URoseImporter::ImportFBXMesh(const FString &FBXPath,
   return nullptr;
 }
 
-UStaticMesh *URoseImporter::ImportRoseMesh(const FString &MP,
-                                           const FRoseZSC::FMaterialEntry *M,
-                                           const FString &RF) {
-  FString CP = MP;
+// Asset name shared by the prebuild pass and ImportRoseMesh so both resolve
+// the same /Game/Rose/Imported/Meshes/<AssetName> package
+static FString GetRoseMeshAssetName(const FString &MeshPath,
+                                    const FRoseZSC::FMaterialEntry *M) {
+  FString CP = MeshPath;
   CP.ReplaceInline(TEXT("\\"), TEXT("/"));
   FString BN = FPaths::GetBaseFilename(CP),
           MS = (M && !M->TexturePath.IsEmpty())
                    ? ObjectTools::SanitizeObjectName(
                          FPaths::GetBaseFilename(M->TexturePath))
                    : TEXT("NoMat");
+  return ObjectTools::SanitizeObjectName(BN) + TEXT("_") + MS;
+}
 
-  // Fix: Use consistent AssetName
-  // (BaseName + Suffix) for both check
-  // and creation
-  FString AssetName = ObjectTools::SanitizeObjectName(BN) + TEXT("_") + MS;
-  FString PN = TEXT("/Game/Rose/"
-                    "Imported/Meshes/") +
-               AssetName;
-  FString MeshFullPath = PN + TEXT(".") + AssetName;
+// True when no two UV2 triangles cover the same texel of a Resolution^2
+// grid (texel centers only, so charts sharing an edge do not count). A few
+// colliding texels are tolerated as rasterization noise.
+static bool HasNonOverlappingUV2(const FRoseZMS &ZMS, int32 Resolution = 64) {
+  TBitArray<> Covered(false, Resolution * Resolution);
+  int32 NumCovered = 0, NumOverlaps = 0;
+  const float Scale = Resolution;
+  const uint32 NumVerts = ZMS.Vertices.Num();
+  for (int32 i = 0; i + 2 < ZMS.Indices.Num(); i += 3) {
+    const uint32 I0 = ZMS.Indices[i], I1 = ZMS.Indices[i + 1],
+                 I2 = ZMS.Indices[i + 2];
+    if (I0 >= NumVerts || I1 >= NumVerts || I2 >= NumVerts)
+      continue;
+    const FVector2f A = ZMS.Vertices[I0].UV2 * Scale;
+    const FVector2f B = ZMS.Vertices[I1].UV2 * Scale;
+    const FVector2f C = ZMS.Vertices[I2].UV2 * Scale;
+    const float Area = FVector2f::CrossProduct(B - A, C - A);
+    if (FMath::IsNearlyZero(Area))
+      continue;
 
-  if (UStaticMesh *E = FindObject<UStaticMesh>(nullptr, *MeshFullPath)) {
-    UpdateMeshMaterial(E, M);
-    return E;
-  }
-  if (UStaticMesh *E = LoadObject<UStaticMesh>(nullptr, *MeshFullPath)) {
-    UpdateMeshMaterial(E, M);
-    return E;
-  }
-  FRoseZMS ZMS;
-  if (!ZMS.Load(FPaths::Combine(RF, CP))) {
-    UE_LOG(LogRoseImporter, Error,
-           TEXT("Failed to load ZMS "
-                "file: '%s' (Root='%s', "
-                "Rel='%s')"),
-           *FPaths::Combine(RF, CP), *RF, *CP);
-    return nullptr;
+    const FVector2f Lo(FMath::Min3(A.X, B.X, C.X), FMath::Min3(A.Y, B.Y, C.Y));
+    const FVector2f Hi(FMath::Max3(A.X, B.X, C.X), FMath::Max3(A.Y, B.Y, C.Y));
+    const int32 X0 = FMath::Max(0, FMath::FloorToInt32(Lo.X));
+    const int32 Y0 = FMath::Max(0, FMath::FloorToInt32(Lo.Y));
+    const int32 X1 = FMath::Min(Resolution - 1, FMath::FloorToInt32(Hi.X));
+    const int32 Y1 = FMath::Min(Resolution - 1, FMath::FloorToInt32(Hi.Y));
+    for (int32 Y = Y0; Y <= Y1; ++Y) {
+      for (int32 X = X0; X <= X1; ++X) {
+        // Inside test with edge functions, either winding
+        const FVector2f P(X + 0.5f, Y + 0.5f);
+        const float W0 = FVector2f::CrossProduct(B - A, P - A) * Area;
+        const float W1 = FVector2f::CrossProduct(C - B, P - B) * Area;
+        const float W2 = FVector2f::CrossProduct(A - C, P - C) * Area;
+        if (W0 < 0.0f || W1 < 0.0f || W2 < 0.0f)
+          continue;
+        const int32 Texel = Y * Resolution + X;
+        if (Covered[Texel]) {
+          NumOverlaps++;
+        } else {
+          Covered[Texel] = true;
+          NumCovered++;
+        }
+      }
+    }
   }
+  return NumCovered > 0 && NumOverlaps <= NumCovered / 100;
+}
+
+bool BuildRoseMeshDescription(const FRoseZMS &ZMS, FMeshDescription &MD,
+                              const FString &DebugName, bool *OutLightmapUVs) {
+  const int32 NumVerts = ZMS.Vertices.Num();
+  const int32 NumTris = ZMS.Indices.Num() / 3;
+  if (NumVerts == 0 || NumTris == 0)
+    return false;
+
+  // One attribute set and one reservation per mesh; the loops below only
+  // write into preallocated storage
+  FStaticMeshAttributes Attributes(MD);
+  Attributes.Register();
+
+  MD.ReserveNewVertices(NumVerts);
+  MD.ReserveNewVertexInstances(NumVerts);
+  MD.ReserveNewTriangles(NumTris);
+  MD.ReserveNewPolygons(NumTris);
+  MD.ReserveNewEdges(NumTris * 3);
 
-  // Build MeshDescription from ZMS data
-  FMeshDescription MD;
-  FStaticMeshAttributes(MD).Register();
   FPolygonGroupID PG = MD.CreatePolygonGroup();
-  FStaticMeshAttributes(MD).GetPolygonGroupMaterialSlotNames()[PG] =
-      FName("RoseMaterial");
-  TArray<FVertexID> VIDs;
-  for (int i = 0; i < ZMS.Vertices.Num(); ++i)
-    VIDs.Add(MD.CreateVertex());
+  Attributes.GetPolygonGroupMaterialSlotNames()[PG] = FName("RoseMaterial");
+  TVertexAttributesRef<FVector3f> VPos = Attributes.GetVertexPositions();
+  TVertexInstanceAttributesRef<FVector3f> VNorms =
+      Attributes.GetVertexInstanceNormals();
+  TVertexInstanceAttributesRef<FVector2f> VUVs =
+      Attributes.GetVertexInstanceUVs();
+
+  // ZMS vertices map 1:1 to vertex instances
   TArray<FVertexInstanceID> VInsts;
-  auto VPos = FStaticMeshAttributes(MD).GetVertexPositions();
-  auto VNorms = FStaticMeshAttributes(MD).GetVertexInstanceNormals();
+  VInsts.SetNumUninitialized(NumVerts);
 
   // Detect active UV channels and
   // variance
@@ -2759,7 +4269,22 @@ UStaticMesh *URoseImporter::ImportRoseMesh(const FString &MP,
     UE_LOG(LogRoseImporter, Warning,
            TEXT("[SmartUV] Swapping UV2→Ch0 "
                 "for '%s' (UV1=%f, UV2=%f)"),
-           *BN, ExtentUV1, ExtentUV2);
+           *DebugName, ExtentUV1, ExtentUV2);
+  }
+
+  // UV2 is a lightmap unwrap when it is not a copy of UV1, stays inside
+  // 0-1 and its triangles do not overlap
+  if (OutLightmapUVs) {
+    bool bDistinct = false;
+    for (const auto &V : ZMS.Vertices) {
+      if (!V.UV1.Equals(V.UV2)) {
+        bDistinct = true;
+        break;
+      }
+    }
+    *OutLightmapUVs = SrcCh0 == 1 && bHasUV2 && bDistinct &&
+                      ExtentUV2 > 0.01f && MinUV2.GetMin() >= 0.0f &&
+                      MaxUV2.GetMax() <= 1.0f && HasNonOverlappingUV2(ZMS);
   }
 
   int32 NumUVs = 1;
@@ -2770,78 +4295,797 @@ UStaticMesh *URoseImporter::ImportRoseMesh(const FString &MP,
   if (bHasUV4)
     NumUVs = 4;
 
-  auto VUVs = FStaticMeshAttributes(MD).GetVertexInstanceUVs();
   VUVs.SetNumChannels(NumUVs);
 
-  for (int i = 0; i < ZMS.Vertices.Num(); ++i) {
-    FVertexInstanceID ID = MD.CreateVertexInstance(VIDs[i]);
-    VInsts.Add(ID);
-    VPos[VIDs[i]] = FVector3f(ZMS.Vertices[i].Position.X * 100.0f,
-                              -ZMS.Vertices[i].Position.Y * 100.0f,
-                              ZMS.Vertices[i].Position.Z * 100.0f);
-    FVector3f N = ZMS.Vertices[i].Normal;
-    N.Y = -N.Y;
-    VNorms[ID] = N;
+  for (int i = 0; i < NumVerts; ++i) {
+    const FRoseZMS::FVertex &V = ZMS.Vertices[i];
+    FVertexID VID = MD.CreateVertex();
+    VPos[VID] = FVector3f(V.Position.X * 100.0f, -V.Position.Y * 100.0f,
+                          V.Position.Z * 100.0f);
+
+    FVertexInstanceID ID = MD.CreateVertexInstance(VID);
+    VInsts[i] = ID;
+    VNorms[ID] = FVector3f(V.Normal.X, -V.Normal.Y, V.Normal.Z);
 
     if (SrcCh0 == 2) {
-      VUVs.Set(ID, 0, ZMS.Vertices[i].UV2);
+      VUVs.Set(ID, 0, V.UV2);
       if (NumUVs >= 2)
-        VUVs.Set(ID, 1, ZMS.Vertices[i].UV1);
+        VUVs.Set(ID, 1, V.UV1);
     } else {
-      VUVs.Set(ID, 0, ZMS.Vertices[i].UV1);
+      VUVs.Set(ID, 0, V.UV1);
       if (bHasUV2 && NumUVs >= 2)
-        VUVs.Set(ID, 1, ZMS.Vertices[i].UV2);
+        VUVs.Set(ID, 1, V.UV2);
     }
     if (bHasUV3 && NumUVs >= 3)
-      VUVs.Set(ID, 2, ZMS.Vertices[i].UV3);
+      VUVs.Set(ID, 2, V.UV3);
     if (bHasUV4 && NumUVs >= 4)
-      VUVs.Set(ID, 3, ZMS.Vertices[i].UV4);
+      VUVs.Set(ID, 3, V.UV4);
   }
 
-  for (int i = 0; i < ZMS.Indices.Num(); i += 3) {
-    TArray<FVertexInstanceID> T;
-    T.Add(VInsts[ZMS.Indices[i]]);
-    T.Add(VInsts[ZMS.Indices[i + 1]]);
-    T.Add(VInsts[ZMS.Indices[i + 2]]);
-    MD.CreateTriangle(PG, T);
+  FVertexInstanceID Tri[3];
+  for (int32 i = 0; i < NumTris * 3; i += 3) {
+    const uint32 I0 = ZMS.Indices[i], I1 = ZMS.Indices[i + 1],
+                 I2 = ZMS.Indices[i + 2];
+    if (I0 >= (uint32)NumVerts || I1 >= (uint32)NumVerts ||
+        I2 >= (uint32)NumVerts)
+      continue;
+    Tri[0] = VInsts[I0];
+    Tri[1] = VInsts[I1];
+    Tri[2] = VInsts[I2];
+    MD.CreateTriangle(PG, MakeArrayView(Tri));
   }
 
+  return true;
+}
+
+// Creates an empty static mesh asset with the importer's single material slot
+// and LOD0 build settings. Geometry is supplied by the caller. An existing
+// asset (stale source on re-import) is reset and rebuilt in place, so
+// components already using it pick up the new geometry.
+static UStaticMesh *CreateRoseStaticMesh(const FString &PackageName,
+                                         const FString &AssetName) {
   // Create mesh directly in its final
   // package (no FBX round-trip)
-  UPackage *MeshPkg = CreatePackage(*PN);
+  UPackage *MeshPkg = CreatePackage(*PackageName);
   MeshPkg->FullyLoad();
 
-  UStaticMesh *FinalMesh =
-      NewObject<UStaticMesh>(MeshPkg, *AssetName, RF_Public | RF_Standalone);
-  FinalMesh->GetStaticMaterials().Add(
+  UStaticMesh *Mesh = FindObject<UStaticMesh>(MeshPkg, *AssetName);
+  if (Mesh) {
+    Mesh->Modify();
+    Mesh->SetNumSourceModels(0);
+    Mesh->GetStaticMaterials().Reset();
+    Mesh->SetNaniteSettings(FMeshNaniteSettings());
+  } else {
+    Mesh =
+        NewObject<UStaticMesh>(MeshPkg, *AssetName, RF_Public | RF_Standalone);
+  }
+  Mesh->GetStaticMaterials().Add(
       FStaticMaterial(nullptr, FName("RoseMaterial")));
-  FStaticMeshSourceModel &SM = FinalMesh->AddSourceModel();
+  FStaticMeshSourceModel &SM = Mesh->AddSourceModel();
   SM.BuildSettings.bRecomputeNormals = false;
   SM.BuildSettings.bRecomputeTangents = true;
   SM.BuildSettings.bRemoveDegenerates = true;
   SM.BuildSettings.bGenerateLightmapUVs = true;
   SM.BuildSettings.SrcLightmapIndex = 0; // Source: texture UVs
   SM.BuildSettings.DstLightmapIndex = 1; // Destination: lightmap channel
-  TArray<const FMeshDescription *> MDPs;
-  MDPs.Add(&MD);
-  FinalMesh->BuildFromMeshDescriptions(MDPs);
+  return Mesh;
+}
+
+// Adds reduced source models after LOD0. Must run before the mesh is built.
+static void ApplyRoseLODRule(UStaticMesh *Mesh, const FRoseLODRule &Rule) {
+  Mesh->SetNumSourceModels(1 + Rule.Levels.Num());
+  Mesh->bAutoComputeLODScreenSize = false;
+
+  FStaticMeshSourceModel &Base = Mesh->GetSourceModel(0);
+  Base.ScreenSize.Default = 1.0f;
+  for (int32 i = 0; i < Rule.Levels.Num(); ++i) {
+    FStaticMeshSourceModel &SM = Mesh->GetSourceModel(i + 1);
+    SM.BuildSettings = Base.BuildSettings;
+    SM.ReductionSettings.PercentTriangles =
+        Rule.Levels[i].PercentTriangles / 100.0f;
+    SM.ReductionSettings.BaseLODModel = 0;
+    SM.ScreenSize.Default = Rule.Levels[i].ScreenSize;
+  }
+}
+
+bool URoseImporter::ApplyMeshRenderPolicy(UStaticMesh *Mesh,
+                                          const FRoseZSC::FMaterialEntry *M,
+                                          ERoseObjectSource Source,
+                                          int32 NumTriangles) {
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+
+  // Same blend detection as GetOrCreateMeshMaterial
+  const bool bOpaque =
+      !(M && M->AlphaEnabled && (M->AlphaTest > 0 || M->BlendType != 0));
+  if (Settings->bEnableNaniteForBuildings &&
+      Source == ERoseObjectSource::Cnst && bOpaque &&
+      NumTriangles >= Settings->NaniteMinTriangles) {
+    // Nanite handles its own detail levels, so no LOD chain
+    FMeshNaniteSettings NaniteSettings = Mesh->GetNaniteSettings();
+    NaniteSettings.bEnabled = true;
+    Mesh->SetNaniteSettings(NaniteSettings);
+    Report.NaniteMeshes.Add(Mesh->GetName());
+    return true;
+  }
+
+  if (const FRoseLODRule *LODRule =
+          Settings->FindLODRule(Source, NumTriangles)) {
+    ApplyRoseLODRule(Mesh, *LODRule);
+    return true;
+  }
+  return false;
+}
+
+const FRoseMeshCollisionUse *
+URoseImporter::FindMeshCollisionUse(const FString &MeshPath) {
+  if (MeshCollisionUses.Num() == 0) {
+    const bool bUseZSCModes =
+        GetDefault<URoseImportSettings>()->bUseZSCCollisionMode;
+    for (const FRoseZSC *ZSC : {&DecoZSC, &CnstZSC, &AnimZSC}) {
+      const bool bConstruction = ZSC == &CnstZSC;
+      for (const FRoseZSC::FObjectEntry &Object : ZSC->Objects) {
+        for (const FRoseZSC::FObjectPart &Part : Object.Parts) {
+          if (!ZSC->Meshes.IsValidIndex(Part.MeshIndex))
+            continue;
+          FString Key = ZSC->Meshes[Part.MeshIndex].MeshPath.Replace(
+              TEXT("\\"), TEXT("/"));
+          Key.ToLowerInline();
+          FRoseMeshCollisionUse &Use = MeshCollisionUses.FindOrAdd(Key);
+          if (bUseZSCModes && Part.bHasCollisionMode) {
+            Use.Shape = FMath::Max<int16>(
+                Use.Shape, Part.CollisionMode & FRoseZSC::COLLISION_SHAPE_MASK);
+          } else {
+            Use.bSizeFallback = true;
+            Use.bConstruction |= bConstruction;
+          }
+        }
+      }
+    }
+  }
+  FString Key = MeshPath.Replace(TEXT("\\"), TEXT("/"));
+  Key.ToLowerInline();
+  return MeshCollisionUses.Find(Key);
+}
+
+void URoseImporter::SetupMeshCollision(UStaticMesh *Mesh,
+                                       const FMeshDescription &MD,
+                                       const FString &MeshPath,
+                                       ERoseObjectSource Source) {
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+  Mesh->CreateBodySetup();
+  UBodySetup *Body = Mesh->GetBodySetup();
+  const FBox Bounds = MD.ComputeBoundingBox();
+  const float Size = Bounds.GetSize().GetMax();
+
+  // Shape from the mesh size, used by parts without a ZSC mode. Complex
+  // collision is never a fallback, only an explicit polygon mode.
+  const int16 SizeShape =
+      Size <= Settings->CollisionBoxMaxSize ? FRoseZSC::COLLISION_AABB : -1;
+
+  // Strongest shape over all parts using the mesh: none < sphere < box <
+  // convex < polygon
+  auto Rank = [](int16 InShape) {
+    if (InShape == FRoseZSC::COLLISION_OBB)
+      return (int32)FRoseZSC::COLLISION_AABB;
+    if (InShape == -1)
+      return (int32)FRoseZSC::COLLISION_POLYGON;
+    if (InShape == FRoseZSC::COLLISION_POLYGON)
+      return FRoseZSC::COLLISION_POLYGON + 1;
+    return (int32)InShape;
+  };
+  int16 Shape = SizeShape;
+  bool bConstruction = Source == ERoseObjectSource::Cnst;
+  if (const FRoseMeshCollisionUse *Use =
+          MeshPath.IsEmpty() ? nullptr : FindMeshCollisionUse(MeshPath)) {
+    Shape = Use->Shape;
+    if (Use->bSizeFallback && Rank(SizeShape) > Rank(Shape)) {
+      Shape = SizeShape;
+    }
+    bConstruction = Use->bConstruction;
+  }
+
+  FName Kind = TEXT("Complex");
+  Body->AggGeom.EmptyElements();
+  if (Shape == FRoseZSC::COLLISION_SPHERE) {
+    FKSphereElem Sphere(Bounds.GetExtent().GetMax());
+    Sphere.Center = Bounds.GetCenter();
+    Body->AggGeom.SphereElems.Add(Sphere);
+    Kind = TEXT("Sphere");
+  } else if (Shape == -1) {
+    // Hulls come from the source description, so they do not depend on
+    // render data being built yet
+    const TVertexAttributesConstRef<FVector3f> Positions =
+        FStaticMeshConstAttributes(MD).GetVertexPositions();
+    TArray<FVector3f> Verts;
+    Verts.SetNumZeroed(MD.Vertices().GetArraySize());
+    for (const FVertexID VertexID : MD.Vertices().GetElementIDs()) {
+      Verts[VertexID.GetValue()] = Positions[VertexID];
+    }
+    TArray<uint32> Indices;
+    Indices.Reserve(MD.Triangles().Num() * 3);
+    for (const FTriangleID TriangleID : MD.Triangles().GetElementIDs()) {
+      for (const FVertexID VertexID : MD.GetTriangleVertices(TriangleID)) {
+        Indices.Add(VertexID.GetValue());
+      }
+    }
+    DecomposeMeshToHulls(Body, Verts, Indices,
+                         bConstruction ? Settings->CollisionMaxHullsConstruction
+                                       : Settings->CollisionMaxHulls,
+                         /*InMaxHullVerts=*/16);
+    Kind = TEXT("Convex");
+    if (Body->AggGeom.ConvexElems.Num() == 0) {
+      // Degenerate input (flat or tiny): a box still blocks
+      Shape = FRoseZSC::COLLISION_AABB;
+    }
+  }
+  if (Shape == FRoseZSC::COLLISION_AABB || Shape == FRoseZSC::COLLISION_OBB) {
+    FKBoxElem Box(Bounds.GetSize().X, Bounds.GetSize().Y, Bounds.GetSize().Z);
+    Box.Center = Bounds.GetCenter();
+    Body->AggGeom.BoxElems.Add(Box);
+    Kind = TEXT("Box");
+  }
+
+  // Only meshes no part wants collision on end up with COLLISION_NONE; they
+  // keep no shapes, and ProcessObjects turns collision off on their HISMs
+  if (Shape == FRoseZSC::COLLISION_NONE) {
+    Kind = TEXT("None");
+    Body->CollisionTraceFlag = ECollisionTraceFlag::CTF_UseDefault;
+  } else if (Kind == TEXT("Complex")) {
+    Body->CollisionTraceFlag = ECollisionTraceFlag::CTF_UseComplexAsSimple;
+  } else {
+    // Simple shapes for movement and physics, triangles for complex traces
+    Body->CollisionTraceFlag = ECollisionTraceFlag::CTF_UseDefault;
+  }
+  Body->InvalidatePhysicsData();
+  Body->CreatePhysicsMeshes();
+  Report.CollisionCounts.FindOrAdd(Kind)++;
+}
+
+void URoseImporter::RecordMeshLODs(const UStaticMesh *Mesh) {
+  const FStaticMeshRenderData *RenderData =
+      Mesh ? Mesh->GetRenderData() : nullptr;
+  if (!RenderData || RenderData->LODResources.Num() < 2)
+    return;
+
+  Report.LODMeshCount++;
+  Report.LODLevelCount += RenderData->LODResources.Num() - 1;
+  Report.LOD0Triangles += RenderData->LODResources[0].GetNumTriangles();
+  Report.LowestLODTriangles +=
+      RenderData->LODResources.Last().GetNumTriangles();
+}
+
+static FString GetRosePrefabAssetName(const FRoseZSC &ZSC, int32 ObjectID) {
+  return FString::Printf(TEXT("Prefab_%s_%d"),
+                         *ObjectTools::SanitizeObjectName(ZSC.Name), ObjectID);
+}
+
+/**
+ * Parts of a prefab candidate merged into one MeshDescription, with the
+ * cost of loading and converting them.
+ */
+struct FRosePrefabDescription {
+  FMeshDescription Merged;
+  // ZSC material of each polygon group, in group order
+  TArray<const FRoseZSC::FMaterialEntry *> Materials;
+  FRoseMeshOptimizeStats OptimizeStats;
+  int32 PartCount = 0;
+  int32 PartTris = 0;
+  double DescSeconds = 0.0;
+};
+
+// Loads, optimizes and appends the parts of a prefab candidate. Parts are
+// appended with their part transform; each distinct ZSC material becomes
+// one polygon group. Touches no UObjects, so it is safe to run from worker
+// threads. Returns false when a part fails to load and the object has to
+// be placed part by part.
+static bool BuildRosePrefabDescription(const FRoseZSC &ZSC,
+                                       const FRoseZSC::FObjectEntry &Object,
+                                       const FString &RootPath,
+                                       const FString &AssetName,
+                                       bool bOptimize, float WeldThreshold,
+                                       FRosePrefabDescription &Out) {
+  FStaticMeshAttributes MergedAttributes(Out.Merged);
+  MergedAttributes.Register();
+  TMap<int32, FPolygonGroupID> MaterialGroups;
+
+  for (const FRoseZSC::FObjectPart &Part : Object.Parts) {
+    const FString MeshPath =
+        ZSC.Meshes[Part.MeshIndex].MeshPath.Replace(TEXT("\\"), TEXT("/"));
+    FRoseZMS ZMS;
+    FMeshDescription PartMD;
+    if (!ZMS.Load(FPaths::Combine(RootPath, MeshPath))) {
+      UE_LOG(LogRoseImporter, Warning,
+             TEXT("[Prefab] %s: failed to load '%s', placing parts "
+                  "individually"),
+             *AssetName, *MeshPath);
+      return false;
+    }
+    if (bOptimize) {
+      FRoseMeshOptimizeStats Stats;
+      RoseMeshOptimizer::Optimize(ZMS, WeldThreshold, &Stats);
+      Out.OptimizeStats.Accumulate(Stats);
+    }
+    const double DescStart = FPlatformTime::Seconds();
+    if (!BuildRoseMeshDescription(ZMS, PartMD, AssetName))
+      continue;
+    Out.PartCount++;
+    Out.PartTris += PartMD.Triangles().Num();
+    Out.DescSeconds += FPlatformTime::Seconds() - DescStart;
+
+    FPolygonGroupID *Group = MaterialGroups.Find(Part.MaterialIndex);
+    if (!Group) {
+      const FPolygonGroupID NewGroup = Out.Merged.CreatePolygonGroup();
+      MergedAttributes.GetPolygonGroupMaterialSlotNames()[NewGroup] =
+          FName(*FString::Printf(TEXT("RoseMaterial_%d"),
+                                 Out.Materials.Num()));
+      Group = &MaterialGroups.Add(Part.MaterialIndex, NewGroup);
+      Out.Materials.Add(ZSC.Materials.IsValidIndex(Part.MaterialIndex)
+                            ? &ZSC.Materials[Part.MaterialIndex]
+                            : nullptr);
+    }
+
+    const FPolygonGroupID TargetGroup = *Group;
+    FStaticMeshOperations::FAppendSettings AppendSettings;
+    AppendSettings.MeshTransform = FTransform(
+        FQuat(Part.Rotation), FVector(Part.Position), FVector(Part.Scale));
+    AppendSettings.PolygonGroupsDelegate =
+        FAppendPolygonGroupsDelegate::CreateLambda(
+            [TargetGroup](const FMeshDescription &SourceMesh,
+                          FMeshDescription &TargetMesh,
+                          PolygonGroupMap &RemapPolygonGroups) {
+              for (const FPolygonGroupID SourceGroup :
+                   SourceMesh.PolygonGroups().GetElementIDs()) {
+                RemapPolygonGroups.Add(SourceGroup, TargetGroup);
+              }
+            });
+    FStaticMeshOperations::AppendMeshDescription(PartMD, Out.Merged,
+                                                 AppendSettings);
+  }
+  return true;
+}
+
+void URoseImporter::PrebuildZoneMeshes(const TArray<FRoseIFO> &IFOs) {
+  const double StartTime = FPlatformTime::Seconds();
+
+  // One job per unique (mesh, material) asset that doesn't exist yet, and
+  // one per merged prefab that doesn't
+  struct FMeshBuildJob {
+    FString MeshPath;
+    const FRoseZSC::FMaterialEntry *Material = nullptr;
+    ERoseObjectSource Source = ERoseObjectSource::Any;
+    FString AssetName;
+    FMeshDescription MeshDesc;
+    FRoseMeshOptimizeStats OptimizeStats;
+    double DescSeconds = 0.0;
+    bool bValid = false;
+    bool bLightmapUVs = false;
+    // Prefab jobs: the merged object and its parts' description
+    const FRoseZSC *PrefabZSC = nullptr;
+    int32 PrefabObjectID = INDEX_NONE;
+    FRosePrefabDescription Prefab;
+  };
+  TArray<FMeshBuildJob> Jobs;
+  TSet<FString> SeenAssets;
+  TSet<TPair<const FRoseZSC *, int32>> SeenPrefabs;
+  const bool bMergePrefabs =
+      GetDefault<URoseImportSettings>()->bMergeObjectPrefabs;
+
+  auto CollectList = [&](const TArray<FRoseMapObject> &MapObjects,
+                         const FRoseZSC &ZSC, ERoseObjectSource Source) {
+    for (const FRoseMapObject &MapObj : MapObjects) {
+      if (MapObj.ObjectID < 0 || MapObj.ObjectID >= ZSC.Objects.Num())
+        continue;
+      // Parts of merged objects are built into the prefab instead
+      const FRoseZSC::FObjectEntry &Object = ZSC.Objects[MapObj.ObjectID];
+      if (bMergePrefabs && Source != ERoseObjectSource::Anim &&
+          IsRosePrefabCandidate(ZSC, Object)) {
+        bool bAlreadySeen = false;
+        SeenPrefabs.Add(TPair<const FRoseZSC *, int32>(&ZSC, MapObj.ObjectID),
+                        &bAlreadySeen);
+        if (bAlreadySeen)
+          continue;
+        // Up-to-date prefab assets are loaded by ResolvePrefab
+        const FString AssetName =
+            GetRosePrefabAssetName(ZSC, MapObj.ObjectID);
+        const FString PN = TEXT("/Game/Rose/Imported/Meshes/") + AssetName;
+        if (!IsStalePrefab(ZSC, Object, PN) &&
+            (FindObject<UStaticMesh>(nullptr,
+                                     *(PN + TEXT(".") + AssetName)) ||
+             FPackageName::DoesPackageExist(PN)))
+          continue;
+
+        FMeshBuildJob &Job = Jobs.AddDefaulted_GetRef();
+        Job.Source = Source;
+        Job.AssetName = AssetName;
+        Job.PrefabZSC = &ZSC;
+        Job.PrefabObjectID = MapObj.ObjectID;
+        continue;
+      }
+
+      for (const FRoseZSC::FObjectPart &Part : Object.Parts) {
+        if (Part.MeshIndex < 0 || Part.MeshIndex >= ZSC.Meshes.Num())
+          continue;
+
+        const FRoseZSC::FMaterialEntry *MatEntry = nullptr;
+        if (Part.MaterialIndex >= 0 &&
+            Part.MaterialIndex < ZSC.Materials.Num()) {
+          MatEntry = &ZSC.Materials[Part.MaterialIndex];
+        }
+
+        const FString &MeshPath = ZSC.Meshes[Part.MeshIndex].MeshPath;
+        FString AssetName = GetRoseMeshAssetName(MeshPath, MatEntry);
+        bool bAlreadySeen = false;
+        SeenAssets.Add(AssetName, &bAlreadySeen);
+        if (bAlreadySeen)
+          continue;
+
+        // Existing assets keep going through ImportRoseMesh, unless their
+        // ZMS changed since the last import
+        FString PN = TEXT("/Game/Rose/Imported/Meshes/") + AssetName;
+        if (!IsStaleAsset(FPaths::Combine(RoseRootPath, MeshPath), PN) &&
+            (FindObject<UStaticMesh>(nullptr,
+                                     *(PN + TEXT(".") + AssetName)) ||
+             FPackageName::DoesPackageExist(PN)))
+          continue;
+
+        FMeshBuildJob &Job = Jobs.AddDefaulted_GetRef();
+        Job.MeshPath = MeshPath.Replace(TEXT("\\"), TEXT("/"));
+        Job.Material = MatEntry;
+        Job.Source = Source;
+        Job.AssetName = AssetName;
+      }
+    }
+  };
+
+  for (const FRoseIFO &IFO : IFOs) {
+    CollectList(IFO.Objects, DecoZSC, ERoseObjectSource::Deco);
+    CollectList(IFO.Buildings, CnstZSC, ERoseObjectSource::Cnst);
+    CollectList(IFO.Animations, AnimZSC, ERoseObjectSource::Anim);
+  }
+
+  if (Jobs.Num() == 0)
+    return;
+
+  // ZMS parsing, optimization, MeshDescription conversion and prefab
+  // merging are pure CPU work
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+  const bool bOptimize = Settings->bOptimizeMeshes;
+  const float WeldThreshold = Settings->MeshWeldThreshold / 100.0f;
+  ParallelFor(Jobs.Num(), [&](int32 Index) {
+    FMeshBuildJob &Job = Jobs[Index];
+    if (Job.PrefabZSC) {
+      Job.bValid =
+          BuildRosePrefabDescription(
+              *Job.PrefabZSC, Job.PrefabZSC->Objects[Job.PrefabObjectID],
+              RoseRootPath, Job.AssetName, bOptimize, WeldThreshold,
+              Job.Prefab) &&
+          Job.Prefab.Materials.Num() > 0;
+      if (Job.bValid) {
+        Job.MeshDesc = MoveTemp(Job.Prefab.Merged);
+        Job.Material = Job.Prefab.Materials[0];
+      }
+      return;
+    }
+    FRoseZMS ZMS;
+    if (!ZMS.Load(FPaths::Combine(RoseRootPath, Job.MeshPath))) {
+      UE_LOG(LogRoseImporter, Error, TEXT("Failed to load ZMS file: '%s'"),
+             *FPaths::Combine(RoseRootPath, Job.MeshPath));
+      return;
+    }
+    if (bOptimize) {
+      RoseMeshOptimizer::Optimize(ZMS, WeldThreshold, &Job.OptimizeStats);
+    }
+    const double DescStart = FPlatformTime::Seconds();
+    Job.bValid = BuildRoseMeshDescription(ZMS, Job.MeshDesc, Job.AssetName,
+                                          &Job.bLightmapUVs);
+    Job.DescSeconds = FPlatformTime::Seconds() - DescStart;
+  });
+
+  const double DescTime = FPlatformTime::Seconds();
+
+  // Asset creation has to happen on the game thread
+  TArray<UStaticMesh *> NewMeshes;
+  TArray<const FMeshBuildJob *> NewMeshJobs;
+  NewMeshes.Reserve(Jobs.Num());
+  for (FMeshBuildJob &Job : Jobs) {
+    if (Job.PrefabZSC) {
+      Report.MeshOptimize.Accumulate(Job.Prefab.OptimizeStats);
+      Report.MeshDescriptionCount += Job.Prefab.PartCount;
+      Report.MeshDescriptionTris += Job.Prefab.PartTris;
+      Report.MeshDescriptionSeconds += Job.Prefab.DescSeconds;
+      if (!Job.bValid) {
+        // A null mesh makes ProcessObjects place the parts one by one
+        ResolvedPrefabs.Add(TPair<const FRoseZSC *, int32>(
+            Job.PrefabZSC, Job.PrefabObjectID));
+        continue;
+      }
+    } else {
+      Report.MeshOptimize.Accumulate(Job.OptimizeStats);
+      if (!Job.bValid)
+        continue;
+      Report.MeshDescriptionCount++;
+      Report.MeshDescriptionTris += Job.MeshDesc.Triangles().Num();
+      Report.MeshDescriptionSeconds += Job.DescSeconds;
+    }
+
+    UStaticMesh *Mesh = CreateRoseStaticMesh(
+        TEXT("/Game/Rose/Imported/Meshes/") + Job.AssetName, Job.AssetName);
+
+    // Assign the materials before the build so the batch build is final
+    if (Job.PrefabZSC) {
+      Mesh->GetStaticMaterials().Reset();
+      for (int32 i = 0; i < Job.Prefab.Materials.Num(); ++i) {
+        Mesh->GetStaticMaterials().Add(FStaticMaterial(
+            GetOrCreateMeshMaterial(Job.Prefab.Materials[i]),
+            FName(*FString::Printf(TEXT("RoseMaterial_%d"), i))));
+      }
+      if (Job.MeshDesc.Vertices().Num() > MAX_uint16) {
+        Report.WideIndexMeshCount++;
+      }
+    } else if (UMaterialInterface *MIC =
+                   GetOrCreateMeshMaterial(Job.Material)) {
+      Mesh->GetStaticMaterials()[0].MaterialInterface = MIC;
+    }
+
+    ApplyLightmapUVPolicy(Mesh, Job.bLightmapUVs);
+    ApplyMeshRenderPolicy(Mesh, Job.Material, Job.Source,
+                          Job.MeshDesc.Triangles().Num());
+
+    Mesh->CreateMeshDescription(0, MoveTemp(Job.MeshDesc));
+    Mesh->CommitMeshDescription(0);
+    NewMeshes.Add(Mesh);
+    NewMeshJobs.Add(&Job);
+  }
+
+  // Build all render data through the async static mesh compiler
+  UStaticMesh::BatchBuild(NewMeshes);
+  FStaticMeshCompilingManager::Get().FinishCompilation(NewMeshes);
+
+  for (int32 i = 0; i < NewMeshes.Num(); ++i) {
+    Report.MeshBuildCount++;
+    Report.BuiltMeshes.Add(NewMeshes[i]);
+    RecordMeshLODs(NewMeshes[i]);
+    // Prefab jobs have no mesh path, so their shape comes from the size
+    SetupMeshCollision(NewMeshes[i], *NewMeshes[i]->GetMeshDescription(0),
+                       NewMeshJobs[i]->MeshPath, NewMeshJobs[i]->Source);
+    SaveRoseAsset(NewMeshes[i]);
+    RefreshedAssets.Add(NewMeshes[i]->GetPackage()->GetName());
+    if (const FRoseZSC *PrefabZSC = NewMeshJobs[i]->PrefabZSC) {
+      ResolvedPrefabs
+          .Add(TPair<const FRoseZSC *, int32>(PrefabZSC,
+                                              NewMeshJobs[i]->PrefabObjectID))
+          .Mesh = NewMeshes[i];
+      Report.PrefabMeshCount++;
+    }
+  }
+
+  UE_LOG(LogRoseImporter, Log,
+         TEXT("[MeshBuild] Prebuilt %d/%d meshes (descriptions %.2fs, "
+              "build %.2fs)"),
+         NewMeshes.Num(), Jobs.Num(), DescTime - StartTime,
+         FPlatformTime::Seconds() - DescTime);
+  Report.MeshBuildSeconds += FPlatformTime::Seconds() - StartTime;
+}
+
+UStaticMesh *URoseImporter::ImportRoseMesh(const FString &MP,
+                                           const FRoseZSC::FMaterialEntry *M,
+                                           const FString &RF,
+                                           ERoseObjectSource Source) {
+  FString CP = MP;
+  CP.ReplaceInline(TEXT("\\"), TEXT("/"));
+
+  // Fix: Use consistent AssetName
+  // (BaseName + Suffix) for both check
+  // and creation
+  FString AssetName = GetRoseMeshAssetName(CP, M);
+  FString PN = TEXT("/Game/Rose/"
+                    "Imported/Meshes/") +
+               AssetName;
+  FString MeshFullPath = PN + TEXT(".") + AssetName;
+
+  if (!IsStaleAsset(FPaths::Combine(RF, CP), PN)) {
+    if (UStaticMesh *E = FindObject<UStaticMesh>(nullptr, *MeshFullPath)) {
+      UpdateMeshMaterial(E, M);
+      return E;
+    }
+    if (UStaticMesh *E = LoadObject<UStaticMesh>(nullptr, *MeshFullPath)) {
+      UpdateMeshMaterial(E, M);
+      return E;
+    }
+  }
+  FRoseZMS ZMS;
+  if (!ZMS.Load(FPaths::Combine(RF, CP))) {
+    UE_LOG(LogRoseImporter, Error,
+           TEXT("Failed to load ZMS "
+                "file: '%s' (Root='%s', "
+                "Rel='%s')"),
+           *FPaths::Combine(RF, CP), *RF, *CP);
+    return nullptr;
+  }
 
-  // Setup collision
-  FinalMesh->CreateBodySetup();
-  FinalMesh->GetBodySetup()->CollisionTraceFlag =
-      ECollisionTraceFlag::CTF_UseComplexAsSimple;
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+  if (Settings->bOptimizeMeshes) {
+    FRoseMeshOptimizeStats Stats;
+    RoseMeshOptimizer::Optimize(ZMS, Settings->MeshWeldThreshold / 100.0f,
+                                &Stats);
+    Report.MeshOptimize.Accumulate(Stats);
+  }
 
-  UpdateMeshMaterial(FinalMesh, M);
+  // Build MeshDescription from ZMS data
+  FMeshDescription MD;
+  bool bLightmapUVs = false;
+  const double DescStart = FPlatformTime::Seconds();
+  if (!BuildRoseMeshDescription(ZMS, MD, FPaths::GetBaseFilename(CP),
+                                &bLightmapUVs))
+    return nullptr;
+  Report.MeshDescriptionCount++;
+  Report.MeshDescriptionTris += MD.Triangles().Num();
+  Report.MeshDescriptionSeconds += FPlatformTime::Seconds() - DescStart;
+
+  // Assign the material before the build; the new mesh is built once
+  UStaticMesh *FinalMesh = CreateRoseStaticMesh(PN, AssetName);
+  FinalMesh->GetStaticMaterials()[0].MaterialInterface =
+      GetOrCreateMeshMaterial(M);
+  BuildNewRoseMesh(FinalMesh, MD, M, Source, CP, bLightmapUVs);
   SaveRoseAsset(FinalMesh);
+  RefreshedAssets.Add(PN);
 
   return FinalMesh;
 }
 
+void URoseImporter::BuildNewRoseMesh(UStaticMesh *Mesh, FMeshDescription &MD,
+                                     const FRoseZSC::FMaterialEntry *M,
+                                     ERoseObjectSource Source,
+                                     const FString &MeshPath,
+                                     bool bZMSLightmapUVs) {
+  const double StartTime = FPlatformTime::Seconds();
+  ApplyLightmapUVPolicy(Mesh, bZMSLightmapUVs);
+  if (ApplyMeshRenderPolicy(Mesh, M, Source, MD.Triangles().Num())) {
+    // Reduced LODs and Nanite need the full build from the stored
+    // description
+    Mesh->CreateMeshDescription(0, MoveTemp(MD));
+    Mesh->CommitMeshDescription(0);
+    Mesh->Build(/*bInSilent=*/true);
+    RecordMeshLODs(Mesh);
+    SetupMeshCollision(Mesh, *Mesh->GetMeshDescription(0), MeshPath, Source);
+  } else {
+    TArray<const FMeshDescription *> MDPs;
+    MDPs.Add(&MD);
+    Mesh->BuildFromMeshDescriptions(MDPs);
+    SetupMeshCollision(Mesh, MD, MeshPath, Source);
+  }
+  Report.MeshBuildCount++;
+  Report.BuiltMeshes.Add(Mesh);
+
+  Report.MeshBuildSeconds += FPlatformTime::Seconds() - StartTime;
+}
+
+void URoseImporter::ApplyLightmapUVPolicy(UStaticMesh *Mesh,
+                                          bool bZMSLightmapUVs) {
+  FMeshBuildSettings &BuildSettings = Mesh->GetSourceModel(0).BuildSettings;
+  switch (GetDefault<URoseImportSettings>()->LightmapUVs) {
+  case ERoseLightmapUVs::None:
+    BuildSettings.bGenerateLightmapUVs = false;
+    Report.LightmapUVsSkipped++;
+    return;
+  case ERoseLightmapUVs::ReuseOrGenerate:
+    if (bZMSLightmapUVs) {
+      // Channel 1 already holds the ZMS unwrap
+      BuildSettings.bGenerateLightmapUVs = false;
+      Mesh->SetLightMapCoordinateIndex(1);
+      Report.LightmapUVsReused++;
+      return;
+    }
+    break;
+  default:
+    break;
+  }
+  BuildSettings.bGenerateLightmapUVs = true;
+  Mesh->SetLightMapCoordinateIndex(BuildSettings.DstLightmapIndex);
+  Report.LightmapUVsGenerated++;
+}
+
+bool URoseImporter::IsStalePrefab(const FRoseZSC &ZSC,
+                                  const FRoseZSC::FObjectEntry &Object,
+                                  const FString &PN) {
+  bool bStale = false;
+  for (const FRoseZSC::FObjectPart &Part : Object.Parts) {
+    bStale |= IsStaleAsset(
+        FPaths::Combine(RoseRootPath, ZSC.Meshes[Part.MeshIndex].MeshPath),
+        PN);
+  }
+  return bStale;
+}
+
+FRoseResolvedPart *URoseImporter::ResolvePrefab(const FRoseZSC &ZSC,
+                                                int32 ObjectID,
+                                                ERoseObjectSource Source) {
+  const TPair<const FRoseZSC *, int32> PrefabKey(&ZSC, ObjectID);
+  if (FRoseResolvedPart *Found = ResolvedPrefabs.Find(PrefabKey)) {
+    return Found;
+  }
+  FRoseResolvedPart &Resolved = ResolvedPrefabs.Add(PrefabKey);
+
+  const FRoseZSC::FObjectEntry &Object = ZSC.Objects[ObjectID];
+  if (!IsRosePrefabCandidate(ZSC, Object))
+    return &Resolved;
+
+  const FString AssetName = GetRosePrefabAssetName(ZSC, ObjectID);
+  const FString PN = TEXT("/Game/Rose/Imported/Meshes/") + AssetName;
+  if (!IsStalePrefab(ZSC, Object, PN)) {
+    if (UStaticMesh *E =
+            LoadObject<UStaticMesh>(nullptr, *(PN + TEXT(".") + AssetName))) {
+      Resolved.Mesh = E;
+      return &Resolved;
+    }
+  }
+
+  // Not prebuilt (placed outside PrebuildZoneMeshes): merge it here
+  const URoseImportSettings *Settings = GetDefault<URoseImportSettings>();
+  FRosePrefabDescription Prefab;
+  const bool bLoaded = BuildRosePrefabDescription(
+      ZSC, Object, RoseRootPath, AssetName, Settings->bOptimizeMeshes,
+      Settings->MeshWeldThreshold / 100.0f, Prefab);
+  Report.MeshOptimize.Accumulate(Prefab.OptimizeStats);
+  Report.MeshDescriptionCount += Prefab.PartCount;
+  Report.MeshDescriptionTris += Prefab.PartTris;
+  Report.MeshDescriptionSeconds += Prefab.DescSeconds;
+  if (!bLoaded || Prefab.Materials.Num() == 0)
+    return &Resolved;
+  if (Prefab.Merged.Vertices().Num() > MAX_uint16) {
+    Report.WideIndexMeshCount++;
+  }
+
+  UStaticMesh *Mesh = CreateRoseStaticMesh(PN, AssetName);
+  Mesh->GetStaticMaterials().Reset();
+  for (int32 i = 0; i < Prefab.Materials.Num(); ++i) {
+    Mesh->GetStaticMaterials().Add(FStaticMaterial(
+        GetOrCreateMeshMaterial(Prefab.Materials[i]),
+        FName(*FString::Printf(TEXT("RoseMaterial_%d"), i))));
+  }
+  // Parts may disagree on collision, so the shape comes from the size. The
+  // parts' UV2 layouts overlap once merged, so lightmap UVs are generated.
+  BuildNewRoseMesh(Mesh, Prefab.Merged, Prefab.Materials[0], Source,
+                   FString(), /*bZMSLightmapUVs=*/false);
+  SaveRoseAsset(Mesh);
+  RefreshedAssets.Add(PN);
+
+  Resolved.Mesh = Mesh;
+  Report.PrefabMeshCount++;
+  return &Resolved;
+}
+
 void URoseImporter::UpdateMeshMaterial(UStaticMesh *Mesh,
                                        const FRoseZSC::FMaterialEntry *M) {
   if (!Mesh || !M)
     return;
 
+  UMaterialInterface *MIC = GetOrCreateMeshMaterial(M);
+  if (!MIC)
+    return;
+
+  TArray<FStaticMaterial> &Slots = Mesh->GetStaticMaterials();
+  if (Slots.Num() > 0 && Slots[0].MaterialInterface == MIC)
+    return;
+
+  // A slot change needs no render data rebuild (sections reference slots
+  // by index), so the mesh is only marked dirty and saved, never rebuilt
+  Mesh->Modify();
+  if (Slots.Num() > 0) {
+    Slots[0].MaterialInterface = MIC;
+  } else {
+    Slots.Add(FStaticMaterial(MIC, FName("RoseMaterial")));
+  }
+  SaveRoseAsset(Mesh);
+  Report.MeshMaterialUpdates++;
+}
+
+UMaterialInterface *
+URoseImporter::GetOrCreateMeshMaterial(const FRoseZSC::FMaterialEntry *M,
+                                       bool bAnimWPO) {
+  if (!M)
+    return nullptr;
+
   // Determine Material Name from
   // TexturePath if possible
   FString MS = TEXT("NoMat");
@@ -2849,6 +5093,9 @@ void URoseImporter::UpdateMeshMaterial(UStaticMesh *Mesh,
     MS = ObjectTools::SanitizeObjectName(
         FPaths::GetBaseFilename(M->TexturePath));
   }
+  if (bAnimWPO) {
+    MS += TEXT("_AnimWPO");
+  }
 
   FString MPN = TEXT("/Game/Rose/Imported/"
                      "Materials/M_") +
@@ -2861,42 +5108,13 @@ void URoseImporter::UpdateMeshMaterial(UStaticMesh *Mesh,
 
   // Performance Optimization: Check
   // Cache
-  if (ProcessedMaterialPaths.Contains(MPN)) {
+  if (UMaterialInstanceConstant *Cached =
+          GetSession().FindMaterialInstance(MPN)) {
     // Already processed (updated &
     // saved) this session. We just need
     // to ensure the Mesh uses it.
-
-    // Try to find it in memory first
-    UMaterialInstanceConstant *MIC =
-        FindObject<UMaterialInstanceConstant>(nullptr, *FullMPN);
-    if (!MIC) {
-      // Load it if not in memory
-      MIC = LoadObject<UMaterialInstanceConstant>(nullptr, *FullMPN);
-    }
-
-    if (MIC) {
-      // [Shadow Fix] Force TwoSided on
-      // cached MICs
-      if (!MIC->BasePropertyOverrides.TwoSided) {
-        MIC->BasePropertyOverrides.bOverride_TwoSided = true;
-        MIC->BasePropertyOverrides.TwoSided = true;
-        MIC->PostEditChange();
-      }
-
-      if (Mesh->GetStaticMaterials().Num() > 0) {
-        // Only assign if different
-        // (avoid dirtying mesh
-        // unnecessarily)
-        if (Mesh->GetStaticMaterials()[0].MaterialInterface != MIC) {
-          Mesh->GetStaticMaterials()[0].MaterialInterface = MIC;
-          Mesh->PostEditChange();
-        }
-      } else {
-        Mesh->GetStaticMaterials().Add(FStaticMaterial(MIC));
-        Mesh->PostEditChange();
-      }
-    }
-    return;
+    // TwoSided was forced when it was processed, no PostEditChange here
+    return Cached;
   }
 
   EnsureMasterMaterial();
@@ -2915,7 +5133,8 @@ void URoseImporter::UpdateMeshMaterial(UStaticMesh *Mesh,
 
   if (MIC) {
     // ALWAYS Update Parameters
-    MIC->SetParentEditorOnly(MasterMaterial);
+    MIC->SetParentEditorOnly(bAnimWPO ? MasterMaterial_AnimWPO
+                                      : MasterMaterial);
 
     // Configure Transparency
     bool bTranslucent = false;
@@ -2929,15 +5148,17 @@ void URoseImporter::UpdateMeshMaterial(UStaticMesh *Mesh,
       }
     }
 
-    UMaterial *ParentMat = MasterMaterial;
+    UMaterial *ParentMat = bAnimWPO ? MasterMaterial_AnimWPO : MasterMaterial;
     if (bMasked) {
-      ParentMat = MasterMaterial_Masked;
+      ParentMat =
+          bAnimWPO ? MasterMaterial_Masked_AnimWPO : MasterMaterial_Masked;
     } else if (bTranslucent) {
-      ParentMat = MasterMaterial_Translucent;
+      ParentMat = bAnimWPO ? MasterMaterial_Translucent_AnimWPO
+                           : MasterMaterial_Translucent;
     }
 
     if (!ParentMat)
-      ParentMat = MasterMaterial;
+      ParentMat = bAnimWPO ? MasterMaterial_AnimWPO : MasterMaterial;
     MIC->SetParentEditorOnly(ParentMat);
 
     if (M->TexturePath.Len() > 0) {
@@ -2966,28 +5187,12 @@ void URoseImporter::UpdateMeshMaterial(UStaticMesh *Mesh,
     }
 
     MIC->PostEditChange();
-    FAssetRegistryModule::AssetCreated(MIC);
-
-    FString MatPackageFileName = FPackageName::LongPackageNameToFilename(
-        MIC->GetPackage()->GetName(), FPackageName::GetAssetPackageExtension());
-
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    SaveArgs.SaveFlags = SAVE_NoError;
-    UPackage::SavePackage(MIC->GetPackage(), MIC, *MatPackageFileName,
-                          SaveArgs);
+    SaveRoseAsset(MIC);
 
     // Mark as Processed
-    ProcessedMaterialPaths.Add(MPN);
-
-    // Assign to Mesh
-    if (Mesh->GetStaticMaterials().Num() > 0) {
-      Mesh->GetStaticMaterials()[0].MaterialInterface = MIC;
-    } else {
-      Mesh->GetStaticMaterials().Add(FStaticMaterial(MIC));
-    }
-    Mesh->PostEditChange();
+    GetSession().AddMaterialInstance(MPN, MIC);
   }
+  return MIC;
 }
 
 UTexture2D *URoseImporter::CreateTextureAssetDXT(UObject *Outer, FName Name,
@@ -3018,7 +5223,7 @@ UTexture2D *URoseImporter::CreateTextureAssetDXT(UObject *Outer, FName Name,
 // ============================================================================
 
 bool URoseImporter::LoadZoneTypeInfo(const FString &RoseDataPath) {
-  if (bZoneTypeInfoLoaded) {
+  if (ZoneTypeInfoSTB) {
     return true; // Already loaded
   }
 
@@ -3045,12 +5250,12 @@ bool URoseImporter::LoadZoneTypeInfo(const FString &RoseDataPath) {
     return false;
   }
 
-  if (ZoneTypeInfoSTB.Load(STBPath)) {
-    bZoneTypeInfoLoaded = true;
+  ZoneTypeInfoSTB = GetSession().GetSTB(STBPath);
+  if (ZoneTypeInfoSTB) {
     UE_LOG(LogRoseImporter, Log,
            TEXT("Loaded ZONETYPEINFO.STB: "
                 "%d zone types"),
-           ZoneTypeInfoSTB.GetRowCount());
+           ZoneTypeInfoSTB->GetRowCount());
     return true;
   }
 
@@ -3062,24 +5267,24 @@ bool URoseImporter::LoadZoneTypeInfo(const FString &RoseDataPath) {
 }
 
 FString URoseImporter::GetTileSetPath(int32 ZoneType) const {
-  if (!bZoneTypeInfoLoaded) {
+  if (!ZoneTypeInfoSTB) {
     UE_LOG(LogRoseImporter, Warning,
            TEXT("ZONETYPEINFO not loaded, "
                 "cannot get TileSet path"));
     return FString();
   }
 
-  if (ZoneType < 0 || ZoneType >= ZoneTypeInfoSTB.GetRowCount()) {
+  if (ZoneType < 0 || ZoneType >= ZoneTypeInfoSTB->GetRowCount()) {
     UE_LOG(LogRoseImporter, Warning,
            TEXT("Invalid ZoneType %d (max: "
                 "%d)"),
-           ZoneType, ZoneTypeInfoSTB.GetRowCount() - 1);
+           ZoneType, ZoneTypeInfoSTB->GetRowCount() - 1);
     return FString();
   }
 
   // Column 6 contains the TileSet
   // filename (e.g., "GRASS.TSI")
-  FString TileSetFile = ZoneTypeInfoSTB.GetCell(ZoneType, 6);
+  FString TileSetFile = ZoneTypeInfoSTB->GetCell(ZoneType, 6);
 
   if (TileSetFile.IsEmpty()) {
     UE_LOG(LogRoseImporter, Warning,
@@ -3102,7 +5307,7 @@ FString URoseImporter::GetTileSetPath(int32 ZoneType) const {
 bool URoseImporter::LoadTileSetForZone(int32 ZoneType,
                                        FRoseTileSet &OutTileSet) {
   // Ensure ZONETYPEINFO is loaded
-  if (!bZoneTypeInfoLoaded) {
+  if (!ZoneTypeInfoSTB) {
     if (!LoadZoneTypeInfo(RoseRootPath)) {
       UE_LOG(LogRoseImporter, Warning,
              TEXT("Cannot load TileSet "
@@ -3120,8 +5325,8 @@ bool URoseImporter::LoadTileSetForZone(int32 ZoneType,
 
   // TileSet files are actually STB
   // format
-  FRoseSTB TileSetSTB;
-  if (!TileSetSTB.Load(TileSetPath)) {
+  TSharedPtr<const FRoseSTB> TileSetSTB = GetSession().GetSTB(TileSetPath);
+  if (!TileSetSTB) {
     UE_LOG(LogRoseImporter, Error,
            TEXT("Failed to load TileSet "
                 "STB: %s"),
@@ -3130,7 +5335,7 @@ bool URoseImporter::LoadTileSetForZone(int32 ZoneType,
   }
 
   // Parse TileSet from STB
-  if (!OutTileSet.LoadFromSTB(TileSetSTB)) {
+  if (!OutTileSet.LoadFromSTB(*TileSetSTB)) {
     UE_LOG(LogRoseImporter, Error,
            TEXT("Failed to parse "
                 "TileSet: %s"),
@@ -3290,29 +5495,8 @@ UTexture2D *URoseImporter::CreateTileMapDataTexture(const FRoseTIL &TIL,
   Tex->GetPlatformData()->Mips[0].BulkData.Unlock();
   Tex->UpdateResource();
 
-  // Notify Asset Registry
-  FAssetRegistryModule::AssetCreated(Tex);
-  Tex->MarkPackageDirty();
-
-  // FORCE SAVE to disk
-  FString PackageFileName = FPackageName::LongPackageNameToFilename(
-      PackageName, FPackageName::GetAssetPackageExtension());
-
-  FSavePackageArgs SaveArgs;
-  SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-  SaveArgs.SaveFlags = SAVE_NoError;
-  SaveArgs.Error = GError;
-
-  if (!UPackage::SavePackage(Package, Tex, *PackageFileName, SaveArgs)) {
-    UE_LOG(LogRoseImporter, Error,
-           TEXT("Failed to SAVE "
-                "TileData asset: %s"),
-           *PackageFileName);
-  } else {
-    // UE_LOG(LogRoseImporter, Log,
-    // TEXT("Saved TileData asset: %s"),
-    // *PackageFileName);
-  }
+  // Queued for the end-of-import save batch
+  SaveRoseAsset(Tex);
 
   UE_LOG(LogRoseImporter, Log,
          TEXT("TileMapData %s created. "
@@ -3370,14 +5554,15 @@ bool URoseImporter::LoadZSCsFromListZone(const FString &RoseDataPath,
     return false;
   }
 
-  FRoseSTB ListZoneSTB;
-  if (!ListZoneSTB.Load(ListZonePath)) {
+  TSharedPtr<const FRoseSTB> ListZonePtr = GetSession().GetSTB(ListZonePath);
+  if (!ListZonePtr) {
     UE_LOG(LogRoseImporter, Error,
            TEXT("Failed to load "
                 "LIST_ZONE.STB: %s"),
            *ListZonePath);
     return false;
   }
+  const FRoseSTB &ListZoneSTB = *ListZonePtr;
 
   // Debug: Search for zone in specific
   // columns
@@ -3405,7 +5590,8 @@ bool URoseImporter::LoadZSCsFromListZone(const FString &RoseDataPath,
   int32 ZonColumnIndex = 3; // Default fallback
   if (ListZoneSTB.GetRowCount() > 0) {
     for (int32 j = 0; j < ListZoneSTB.GetColumnCount(); ++j) {
-      if (ListZoneSTB.GetCell(0, j).ToUpper() == TEXT("ZON")) {
+      if (ListZoneSTB.GetCellView(0, j).Equals(FAnsiStringView("ZON"),
+                                               ESearchCase::IgnoreCase)) {
         ZonColumnIndex = j;
         UE_LOG(LogRoseImporter, Log,
                TEXT("Found 'ZON' column "
@@ -3416,47 +5602,29 @@ bool URoseImporter::LoadZSCsFromListZone(const FString &RoseDataPath,
     }
   }
 
-  for (const FString &SearchNameCandidate : ZoneNames) {
-    FString SearchName = SearchNameCandidate.ToUpper();
-
-    for (int32 i = 0; i < ListZoneSTB.GetRowCount(); ++i) {
-      // Safe cell access helper
-      auto SafeGetCell = [&](int32 Row, int32 Col) -> FString {
-        if (Row >= 0 && Row < ListZoneSTB.GetRowCount() && Col >= 0 &&
-            Col < ListZoneSTB.GetColumnCount()) {
-          return ListZoneSTB.GetCell(Row, Col);
-        }
-        return FString();
-      };
-
-      // Column 1 is usually the
-      // Shouting/Zone ID (e.g. JDT01)
-      FString RowName1 = FPaths::GetBaseFilename(SafeGetCell(i, 1)).ToUpper();
-
-      // Column 2 is sometimes used?
-      // Check both.
-      FString RowName2 = FPaths::GetBaseFilename(SafeGetCell(i, 2)).ToUpper();
-
-      // Use dynamic ZON column index
-      FString RowZonFile =
-          FPaths::GetBaseFilename(SafeGetCell(i, ZonColumnIndex)).ToUpper();
-
-      if (RowName1 == SearchName || RowName2 == SearchName ||
-          RowZonFile == SearchName) {
-        UE_LOG(LogRoseImporter, Log,
-               TEXT("MATCH FOUND at Row "
-                    "%d: Col1='%s', "
-                    "Col2='%s', Col%d='%s' "
-                    "(Search='%s')"),
-               i, *RowName1, *RowName2, ZonColumnIndex, *RowZonFile,
-               *SearchName);
-        FoundRow = i;
-        MatchedZoneName = SearchNameCandidate;
-        break;
+  for (const FString &SearchName : ZoneNames) {
+    // Column 1 is usually the Shouting/Zone ID (e.g. JDT01), column 2 is
+    // sometimes used, and the ZON column holds the file. Cells compare by
+    // base file name; the earliest matching row wins.
+    for (int32 Column : {1, 2, ZonColumnIndex}) {
+      const int32 Row = ListZoneSTB.FindRow(Column, SearchName,
+                                            /*bBaseFilename=*/true);
+      if (Row != INDEX_NONE && (FoundRow == -1 || Row < FoundRow)) {
+        FoundRow = Row;
       }
     }
-    if (FoundRow != -1)
+    if (FoundRow != -1) {
+      UE_LOG(LogRoseImporter, Log,
+             TEXT("MATCH FOUND at Row "
+                  "%d: Col1='%s', "
+                  "Col2='%s', Col%d='%s' "
+                  "(Search='%s')"),
+             FoundRow, *ListZoneSTB.GetCell(FoundRow, 1),
+             *ListZoneSTB.GetCell(FoundRow, 2), ZonColumnIndex,
+             *ListZoneSTB.GetCell(FoundRow, ZonColumnIndex), *SearchName);
+      MatchedZoneName = SearchName;
       break;
+    }
   }
 
   if (FoundRow == -1) {
@@ -3600,6 +5768,29 @@ bool URoseImporter::LoadZSCsFromListZone(const FString &RoseDataPath,
   return bSuccess;
 }
 
+bool URoseImporter::IsStaleAsset(const FString &SourcePath,
+                                 const FString &PackageName) const {
+  return StaleSourceFiles.Num() > 0 && !RefreshedAssets.Contains(PackageName) &&
+         StaleSourceFiles.Contains(MakeRoseSourceKey(SourcePath));
+}
+
+URoseMapInfo *URoseImporter::GetOrCreateZoneManifest(const FString &ZoneName) {
+  const FString AssetName =
+      TEXT("MapInfo_") + ObjectTools::SanitizeObjectName(ZoneName);
+  const FString PackageName = TEXT("/Game/Rose/Imported/Zones/") + AssetName;
+  if (URoseMapInfo *Existing = LoadObject<URoseMapInfo>(
+          nullptr, *(PackageName + TEXT(".") + AssetName))) {
+    return Existing;
+  }
+
+  // Empty manifest: its ZoneHash never matches, so the import is a full one
+  UPackage *Package = CreatePackage(*PackageName);
+  URoseMapInfo *Manifest =
+      NewObject<URoseMapInfo>(Package, *AssetName, RF_Public | RF_Standalone);
+  FAssetRegistryModule::AssetCreated(Manifest);
+  return Manifest;
+}
+
 bool URoseImporter::SaveRoseAsset(UObject *Asset) {
   if (!Asset)
     return false;
@@ -3610,42 +5801,80 @@ bool URoseImporter::SaveRoseAsset(UObject *Asset) {
 
   Asset->SetFlags(RF_Public | RF_Standalone);
   Pkg->MarkPackageDirty();
-  FAssetRegistryModule::AssetCreated(Asset);
 
-  FString PackageFileName = FPackageName::LongPackageNameToFilename(
-      Pkg->GetName(), FPackageName::GetAssetPackageExtension());
+  // Saving is deferred to FlushPendingSaves so each package is written once
+  // per import, no matter how many times it was touched.
+  PendingSaveAssets.Add(Pkg, Asset);
+  return true;
+}
+
+int32 URoseImporter::FlushPendingSaves() {
+  if (PendingSaveAssets.Num() == 0)
+    return 0;
 
-  // DEBUG: Log where we're saving
-  UE_LOG(LogRoseImporter, Warning,
-         TEXT("[SaveAsset] Package: %s "
-              "-> File: %s"),
-         *Pkg->GetName(), *PackageFileName);
+  const double StartTime = FPlatformTime::Seconds();
+
+  TArray<FPackageSaveInfo> SaveInfos;
+  SaveInfos.Reserve(PendingSaveAssets.Num());
+  for (const auto &Elem : PendingSaveAssets) {
+    if (!IsValid(Elem.Key) || !IsValid(Elem.Value))
+      continue;
+
+    FAssetRegistryModule::AssetCreated(Elem.Value);
+
+    FPackageSaveInfo &Info = SaveInfos.AddDefaulted_GetRef();
+    Info.Package = Elem.Key;
+    Info.Asset = Elem.Value;
+    Info.Filename = FPackageName::LongPackageNameToFilename(
+        Elem.Key->GetName(), FPackageName::GetAssetPackageExtension());
+  }
+  PendingSaveAssets.Empty();
 
   FSavePackageArgs SaveArgs;
   SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
   SaveArgs.Error = GError;
   SaveArgs.SaveFlags = SAVE_NoError;
 
-  if (UPackage::SavePackage(Pkg, Asset, *PackageFileName, SaveArgs)) {
-    UE_LOG(LogRoseImporter, Verbose, TEXT("Saved asset: %s"), *PackageFileName);
+  TArray<FString> SavedFiles;
+  SavedFiles.Reserve(SaveInfos.Num());
+
+  if (SaveInfos.Num() > 1) {
+    // Serialize all packages in parallel, file writes are still ordered
+    SaveArgs.SaveFlags |= SAVE_Concurrent;
+    TArray<FSavePackageResultStruct> Results;
+    UPackage::SaveConcurrent(SaveInfos, SaveArgs, Results);
 
-    // Force Asset Registry to scan the
-    // file we just saved
+    for (int32 i = 0; i < SaveInfos.Num(); ++i) {
+      if (Results.IsValidIndex(i) && Results[i].IsSuccessful()) {
+        SavedFiles.Add(SaveInfos[i].Filename);
+      } else {
+        UE_LOG(LogRoseImporter, Error, TEXT("Failed to save asset: %s"),
+               *SaveInfos[i].Filename);
+      }
+    }
+  } else {
+    for (const FPackageSaveInfo &Info : SaveInfos) {
+      if (UPackage::SavePackage(Info.Package, Info.Asset, *Info.Filename,
+                                SaveArgs)) {
+        SavedFiles.Add(Info.Filename);
+      } else {
+        UE_LOG(LogRoseImporter, Error, TEXT("Failed to save asset: %s"),
+               *Info.Filename);
+      }
+    }
+  }
+
+  // Single registry scan for everything written during this import
+  if (SavedFiles.Num() > 0) {
     FAssetRegistryModule &AssetRegistryModule =
         FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
             "AssetRegistry");
-    AssetRegistryModule.Get().ScanFilesSynchronous(
-        TArray<FString>{PackageFileName}, true);
+    AssetRegistryModule.Get().ScanFilesSynchronous(SavedFiles, true);
+  }
 
-    UE_LOG(LogRoseImporter, Warning,
-           TEXT("[SaveAsset] File "
-                "scanned: %s"),
-           *PackageFileName);
+  UE_LOG(LogRoseImporter, Log,
+         TEXT("[SaveAsset] Saved %d/%d packages in %.2fs"), SavedFiles.Num(),
+         SaveInfos.Num(), FPlatformTime::Seconds() - StartTime);
 
-    return true;
-  } else {
-    UE_LOG(LogRoseImporter, Error, TEXT("Failed to save asset: %s"),
-           *PackageFileName);
-    return false;
-  }
+  return SavedFiles.Num();
 }
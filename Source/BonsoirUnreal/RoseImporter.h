@@ -3,28 +3,26 @@
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "CoreMinimal.h"
 #include "RoseFormats.h"
+#include "RoseImportSession.h"
+#include "RoseImportSettings.h"
+#include "RoseMeshOptimizer.h"
 #include "RoseImporter.generated.h"
 
 /**
  * Animation component that drives mesh transforms from ZMO data.
- * Stores keyframe channels and applies interpolated transforms each tick.
+ * References a shared clip and applies interpolated transforms each tick.
+ * The tick rate drops with distance to the nearest view, and evaluation
+ * stops while the owner is not rendered.
  */
 UCLASS()
 class URoseAnimComponent : public UActorComponent {
   GENERATED_BODY()
 
 public:
-  // ZMO animation data
-  int32 FPS = 30;
-  int32 FrameCount = 0;
-  float Duration = 0.0f;
+  // Shared ZMO clip (owned by the importer's clip cache)
+  TSharedPtr<const FRoseAnimClip> Clip;
   float ElapsedTime = 0.0f;
 
-  // Channel data
-  TArray<FVector3f> PosKeys;
-  TArray<FQuat4f> RotKeys;
-  TArray<FVector3f> ScaleKeys;
-
   // Target component to animate
   UPROPERTY()
   USceneComponent *TargetComponent = nullptr;
@@ -34,6 +32,13 @@ public:
   FRotator BaseRotation = FRotator::ZeroRotator;
   FVector BaseScale = FVector::OneVector;
 
+  // Significance tiers (distances in cm, intervals in seconds)
+  static constexpr float NearDistance = 3000.0f;
+  static constexpr float MidDistance = 10000.0f;
+  static constexpr float MidTickInterval = 1.0f / 15.0f;
+  static constexpr float FarTickInterval = 1.0f / 5.0f;
+  static constexpr float HiddenTickInterval = 0.5f;
+
   URoseAnimComponent() {
     PrimaryComponentTick.bCanEverTick = true;
     PrimaryComponentTick.bStartWithTickEnabled = true;
@@ -44,44 +49,42 @@ public:
   TickComponent(float DeltaTime, ELevelTick TickType,
                 FActorComponentTickFunction *ThisTickFunction) override {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    SCOPE_CYCLE_COUNTER(STAT_RoseAnimTick);
 
-    if (!TargetComponent || Duration <= 0.0f)
+    if (!TargetComponent || !Clip || !Clip->IsPlayable())
       return;
 
-    // Advance time and loop
+    // Advance time and loop (DeltaTime spans the whole throttled interval)
+    const float Duration = Clip->GetDuration();
     ElapsedTime += DeltaTime;
     if (ElapsedTime >= Duration)
       ElapsedTime = FMath::Fmod(ElapsedTime, Duration);
 
-    // Calculate frame index and interpolation alpha
-    float FrameF = ElapsedTime * (float)FPS;
-    int32 Frame0 = FMath::FloorToInt(FrameF);
-    float Alpha = FrameF - (float)Frame0;
-    int32 Frame1 = Frame0 + 1;
-
-    // Apply position
-    if (PosKeys.Num() > 0) {
-      Frame0 = FMath::Clamp(Frame0, 0, PosKeys.Num() - 1);
-      Frame1 = FMath::Clamp(Frame1, 0, PosKeys.Num() - 1);
-      FVector3f Pos = FMath::Lerp(PosKeys[Frame0], PosKeys[Frame1], Alpha);
-      TargetComponent->SetRelativeLocation((FVector)Pos);
+    // Not on screen: keep time running, check again later
+    AActor *Owner = GetOwner();
+    if (Owner && !Owner->WasRecentlyRendered(HiddenTickInterval)) {
+      SetComponentTickInterval(HiddenTickInterval);
+      INC_DWORD_STAT(STAT_RoseAnimSkipped);
+      return;
     }
 
-    // Apply rotation
-    if (RotKeys.Num() > 0) {
-      Frame0 = FMath::Clamp(FMath::FloorToInt(FrameF), 0, RotKeys.Num() - 1);
-      Frame1 = FMath::Clamp(Frame0 + 1, 0, RotKeys.Num() - 1);
-      FQuat4f Rot = FQuat4f::Slerp(RotKeys[Frame0], RotKeys[Frame1], Alpha);
-      TargetComponent->SetRelativeRotation(((FQuat)Rot).Rotator());
+    double MinDistSq = TNumericLimits<double>::Max();
+    const FVector Location = TargetComponent->GetComponentLocation();
+    for (const FVector &View : GetWorld()->ViewLocationsRenderedLastFrame) {
+      MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(View, Location));
     }
-
-    // Apply scale
-    if (ScaleKeys.Num() > 0) {
-      Frame0 = FMath::Clamp(FMath::FloorToInt(FrameF), 0, ScaleKeys.Num() - 1);
-      Frame1 = FMath::Clamp(Frame0 + 1, 0, ScaleKeys.Num() - 1);
-      FVector3f Scl = FMath::Lerp(ScaleKeys[Frame0], ScaleKeys[Frame1], Alpha);
-      TargetComponent->SetRelativeScale3D((FVector)Scl);
+    const float Interval = MinDistSq < FMath::Square(NearDistance) ? 0.0f
+                           : MinDistSq < FMath::Square(MidDistance)
+                               ? MidTickInterval
+                               : FarTickInterval;
+    if (Interval != GetComponentTickInterval()) {
+      SetComponentTickInterval(Interval);
     }
+
+    // Missing channels evaluate to identity, matching the rest pose, so one
+    // transform update covers all three
+    TargetComponent->SetRelativeTransform(Clip->Evaluate(ElapsedTime));
+    INC_DWORD_STAT(STAT_RoseAnimEvaluated);
   }
 };
 
@@ -97,7 +100,194 @@ struct FLoadedTile {
   FRoseTIL TIL;
 };
 
+/**
+ * Identifies a ZSC object part by the data that decides its mesh:
+ * the owning ZSC plus its mesh and material indices.
+ */
+struct FRosePartKey {
+  const FRoseZSC *ZSC = nullptr;
+  int32 MeshIndex = INDEX_NONE;
+  int32 MaterialIndex = INDEX_NONE;
+
+  bool operator==(const FRosePartKey &Other) const {
+    return ZSC == Other.ZSC && MeshIndex == Other.MeshIndex &&
+           MaterialIndex == Other.MaterialIndex;
+  }
+
+  friend uint32 GetTypeHash(const FRosePartKey &Key) {
+    return HashCombine(GetTypeHash(Key.ZSC),
+                       HashCombine(GetTypeHash(Key.MeshIndex),
+                                   GetTypeHash(Key.MaterialIndex)));
+  }
+};
+
+/**
+ * Collision asked for by every ZSC part that places one ZMS. The mesh is
+ * shared, so its body setup has to satisfy all of them.
+ */
+struct FRoseMeshCollisionUse {
+  // Strongest explicit ZSC shape, COLLISION_NONE when no part set one
+  int16 Shape = FRoseZSC::COLLISION_NONE;
+  // Some part has no explicit mode and falls back to the mesh size
+  bool bSizeFallback = false;
+  // One of those parts is a construction (larger hull budget)
+  bool bConstruction = false;
+};
+
+/**
+ * Cull classes for zone HISMs. Instances of different classes never share a
+ * component, so each class can carry its own render settings.
+ */
+enum class ERoseCullClass : uint8 {
+  Default,
+  Grass, // Small ground cover: no collision, no navigation, no DF lighting
+};
+
+/**
+ * Everything that has to match for two instances to share one HISM.
+ * The mesh alone is not enough: the same mesh can be placed with different
+ * materials, shadow or collision settings.
+ */
+struct FRoseHISMKey {
+  UStaticMesh *Mesh = nullptr;
+  UMaterialInterface *Material = nullptr;
+  bool bCastShadow = true;
+  FName CollisionProfile = NAME_None; // NAME_None keeps the default profile
+  ERoseCullClass CullClass = ERoseCullClass::Default;
+  FIntPoint Cell = FIntPoint::ZeroValue; // Partition cell (ERoseHISMPartition)
+  int32 CullRule = INDEX_NONE; // URoseImportSettings::CullDistanceRules
+
+  bool operator==(const FRoseHISMKey &Other) const {
+    return Mesh == Other.Mesh && Material == Other.Material &&
+           bCastShadow == Other.bCastShadow &&
+           CollisionProfile == Other.CollisionProfile &&
+           CullClass == Other.CullClass && Cell == Other.Cell &&
+           CullRule == Other.CullRule;
+  }
+
+  friend uint32 GetTypeHash(const FRoseHISMKey &Key) {
+    uint32 Hash = HashCombine(GetTypeHash(Key.Mesh), GetTypeHash(Key.Material));
+    Hash = HashCombine(Hash, GetTypeHash(Key.bCastShadow));
+    Hash = HashCombine(Hash, GetTypeHash(Key.CollisionProfile));
+    Hash = HashCombine(Hash, GetTypeHash((uint8)Key.CullClass));
+    Hash = HashCombine(Hash, GetTypeHash(Key.Cell));
+    return HashCombine(Hash, GetTypeHash(Key.CullRule));
+  }
+};
+
+/**
+ * Result of resolving a part once per import. Mesh stays null when the
+ * part's ZMS failed to import so it is not retried. HISMKey is filled on
+ * first placement; only its Cell changes between placements.
+ */
+struct FRoseResolvedPart {
+  UStaticMesh *Mesh = nullptr;
+  FRoseHISMKey HISMKey;
+  bool bHasHISMKey = false;
+};
+
+/**
+ * Summary of a zone import, logged when ImportZone finishes.
+ */
+struct FRoseImportReport {
+  int32 HISMCount = 0;
+  int32 InstanceCount = 0;
+
+  // Components and instances per cull rule index (INDEX_NONE: no rule)
+  TMap<int32, int32> CullRuleHISMs;
+  TMap<int32, int32> CullRuleInstances;
+
+  int32 AnimatedCount = 0;
+  int32 AnimClipCount = 0;
+  int32 AnimClipCacheHits = 0;
+  int32 AnimBakedCount = 0;
+
+  // Generated LODs on meshes built during this import
+  int32 LODMeshCount = 0;
+  int32 LODLevelCount = 0;
+  int64 LOD0Triangles = 0;
+  int64 LowestLODTriangles = 0;
+
+  // Meshes built with Nanite enabled
+  TArray<FString> NaniteMeshes;
+
+  // New meshes per collision setup (Box, Sphere, Convex, Complex)
+  TMap<FName, int32> CollisionCounts;
+
+  // Static mesh builds this import and the meshes they built; the two
+  // match when no mesh was built twice
+  int32 MeshBuildCount = 0;
+  TSet<const UStaticMesh *> BuiltMeshes;
+  int32 MeshMaterialUpdates = 0;
+
+  // Merged multi-part objects (bMergeObjectPrefabs)
+  int32 PrefabMeshCount = 0;
+  int32 PrefabInstanceCount = 0;
+  int32 PrefabPartInstancesSaved = 0;
+
+  // Prefab meshes and HLOD proxies that needed 32-bit index buffers
+  int32 WideIndexMeshCount = 0;
+
+  // Per-cell HLOD proxies (or cell actors given an HLOD layer)
+  int32 HLODCellCount = 0;
+  int32 HLODSourceHISMs = 0;
+  int64 HLODTriangles = 0;
+  bool bHLODLayerOnly = false;
+
+  // Vertex welding and cache optimization over all new meshes
+  FRoseMeshOptimizeStats MeshOptimize;
+
+  // ZMS -> MeshDescription conversions and their summed time (worker time
+  // for the parallel prebuild)
+  int32 MeshDescriptionCount = 0;
+  int32 MeshDescriptionTris = 0;
+  double MeshDescriptionSeconds = 0.0;
+
+  // Lightmap channel of new meshes, per URoseImportSettings::LightmapUVs
+  int32 LightmapUVsGenerated = 0;
+  int32 LightmapUVsReused = 0;
+  int32 LightmapUVsSkipped = 0;
+
+  // Wall time per import phase. Mesh builds include the prebuild pass and
+  // meshes built on demand during placement; placement excludes the latter.
+  double HashSeconds = 0.0;
+  double LandscapeSeconds = 0.0;
+  double MeshBuildSeconds = 0.0;
+  double PlacementSeconds = 0.0;
+  double FinalizeSeconds = 0.0;
+
+  // Incremental re-import (bIncrementalReimport): tiles placed again and
+  // left alone, partition cells rebuilt and kept, assets rebuilt because
+  // their source file changed
+  bool bIncremental = false;
+  int32 TilesRebuilt = 0;
+  int32 TilesKept = 0;
+  int32 CellsRebuilt = 0;
+  int32 CellsKept = 0;
+  bool bLandscapeRebuilt = true;
+  int32 StaleAssetsRebuilt = 0;
+
+  void Log(const FString &ZoneName) const;
+};
+
+// Converts a loaded ZMS into a static MeshDescription. Touches no UObjects,
+// so it is safe to run from worker threads. OutLightmapUVs, when given, is
+// set when UV channel 1 holds a ZMS UV2 that can be used as the lightmap.
+bool BuildRoseMeshDescription(const FRoseZMS &ZMS, FMeshDescription &MD,
+                              const FString &DebugName,
+                              bool *OutLightmapUVs = nullptr);
+
+// Reorders instances along a Z-order (Morton) curve of their XY position so
+// neighbours in the buffer are neighbours in the world. XY is quantized to
+// 16 bits per axis over the buffer's own bounds. CustomData, when given and
+// not empty, holds a fixed number of floats per instance and is reordered
+// alongside.
+void SortInstancesByMorton(TArray<FTransform> &Transforms,
+                           TArray<float> *CustomData);
+
 class ALandscape;
+class URoseAnimManagerComponent;
+class URoseMapInfo;
 class USkeleton;
 class USkeletalMesh;
 class UAnimSequence;
@@ -144,9 +334,16 @@ private:
   UPROPERTY()
   UMaterial *MasterMaterial_Translucent = nullptr;
 
-  // Zone Type Info
-  bool bZoneTypeInfoLoaded = false;
-  FRoseSTB ZoneTypeInfoSTB;
+  // Variants that play a baked animation texture through WPO
+  UPROPERTY()
+  UMaterial *MasterMaterial_AnimWPO = nullptr;
+  UPROPERTY()
+  UMaterial *MasterMaterial_Masked_AnimWPO = nullptr;
+  UPROPERTY()
+  UMaterial *MasterMaterial_Translucent_AnimWPO = nullptr;
+
+  // Zone Type Info (shared with the session's STB cache)
+  TSharedPtr<const FRoseSTB> ZoneTypeInfoSTB;
 
   // Current TileSet
   bool bCurrentTileSetValid = false;
@@ -158,16 +355,83 @@ private:
   FRoseZSC AnimZSC; // Dynamically discovered (Type 6 objects)
 
   // HISM Management
-  UPROPERTY()
-  TMap<UStaticMesh *, UHierarchicalInstancedStaticMeshComponent *>
+  TMap<FRoseHISMKey, UHierarchicalInstancedStaticMeshComponent *>
       GlobalHISMMap;
 
+  // Every HISM created for the current zone (keeps them referenced)
+  UPROPERTY()
+  TArray<UHierarchicalInstancedStaticMeshComponent *> ZoneHISMs;
+
   UPROPERTY()
   AActor *ZoneObjectsActor = nullptr;
 
-  // Bone world transforms in Unreal LHS space, populated by ImportSkeleton.
-  // Used for rigid face/hair binding (full transform: rotation + translation).
-  TMap<FName, FTransform> BoneWorldTransformsLHS;
+  // Batched animation driver on ZoneObjectsActor (bBatchAnimatedObjects)
+  UPROPERTY()
+  URoseAnimManagerComponent *AnimManager = nullptr;
+
+  // Per-cell owner actors when URoseImportSettings::bSpawnPartitionActors
+  UPROPERTY()
+  TMap<FIntPoint, AActor *> PartitionActors;
+
+  // Zone directory name of the import in progress
+  FString CurrentZoneName;
+
+  // Instance transforms buffered per HISM until the end of the import
+  TMap<UHierarchicalInstancedStaticMeshComponent *, TArray<FTransform>>
+      PendingHISMInstances;
+
+  // Per-instance custom data, NumCustomDataFloats per queued transform
+  TMap<UHierarchicalInstancedStaticMeshComponent *, TArray<float>>
+      PendingHISMCustomData;
+
+  // Baked animation textures by clip key (bBakeAnimatedObjectsToWPO)
+  UPROPERTY()
+  TMap<FString, UTexture2D *> AnimBakeTextures;
+
+  // Per-import part resolution cache (meshes and HISMs are owned elsewhere)
+  TMap<FRosePartKey, FRoseResolvedPart> ResolvedParts;
+  int32 PartCacheHits = 0;
+
+  // Collision asked for each ZMS by the parts of the loaded ZSCs, keyed by
+  // lower-case mesh path; filled on first use
+  TMap<FString, FRoseMeshCollisionUse> MeshCollisionUses;
+
+  // Merged prefab per (ZSC, object ID); a null Mesh places parts instead
+  TMap<TPair<const FRoseZSC *, int32>, FRoseResolvedPart> ResolvedPrefabs;
+
+  // ZMO clips used by this import, by normalized path; null marks a failed
+  // load. The clips themselves are owned by the session.
+  TMap<FString, TSharedPtr<const FRoseAnimClip>> AnimClipCache;
+  int32 AnimClipCacheHits = 0;
+
+  // Cull rule per (ZSC object, mesh index); the rule depends on both the
+  // object's bounds and the part's mesh path
+  TMap<TPair<const FRoseZSC::FObjectEntry *, int32>, int32> ObjectCullRules;
+
+  FRoseImportReport Report;
+
+  // Incremental re-import: HISMs are only created in RebuildCells, the
+  // other cells keep the actors of the previous import
+  bool bRestrictToRebuildCells = false;
+  TSet<FIntPoint> RebuildCells;
+
+  // Source files whose hash changed since the last import, and the asset
+  // packages already rebuilt from them during this one
+  TSet<FString> StaleSourceFiles;
+  TSet<FString> RefreshedAssets;
+
+  // Remap and bone world transforms of the skeleton ImportSkeleton last
+  // returned, shared with the session
+  TSharedPtr<const FRoseSkeletonBinding> SkeletonBinding;
+
+  // Editor-wide caches (a private one when there is no editor)
+  UPROPERTY()
+  URoseImportSession *Session = nullptr;
+
+  URoseImportSession &GetSession();
+
+  // SkeletonBinding, or an empty binding before any skeleton was imported
+  const FRoseSkeletonBinding &GetSkeletonBinding() const;
 
   // Helper Functions
   bool LoadZoneTypeInfo(const FString &RootPath);
@@ -181,6 +445,25 @@ private:
   void EnsureMasterMaterial();
   UTexture2D *LoadRoseTexture(const FString &RelPath);
 
+  // Source file LoadRoseTexture reads for RelPath (empty if not found)
+  FString ResolveRoseTexturePath(const FString &RelPath) const;
+
+  // Manifest of the zone's last import, /Game/Rose/Imported/Zones/MapInfo_*
+  URoseMapInfo *GetOrCreateZoneManifest(const FString &ZoneName);
+
+  // ZMS, ZMO and texture files the IFO's objects are built from.
+  // TextureFiles caches texture path resolution between calls.
+  void CollectIFOSources(const FRoseIFO &IFO, TSet<FString> &OutSources,
+                         TMap<FString, FString> &TextureFiles) const;
+
+  // Partition cells the IFO's objects will be placed in
+  void CollectIFOCells(const FRoseIFO &IFO, TSet<FIntPoint> &OutCells) const;
+
+  // True when the asset in PackageName was built from a source file that
+  // changed, and has not been rebuilt yet during this import
+  bool IsStaleAsset(const FString &SourcePath,
+                    const FString &PackageName) const;
+
   // Helper for DXT decompression
   void DecompressDXT3Block(const uint8 *B, uint8 *D, int32 S);
   void DecompressDXT1Block(const uint8 *B, uint8 *D, int32 S);
@@ -189,12 +472,73 @@ private:
                                     int32 H, EPixelFormat F,
                                     const TArray<uint8> &D);
 
-  UStaticMesh *ImportRoseMesh(const FString &RelPath,
-                              const FRoseZSC::FMaterialEntry *M = nullptr,
-                              const FString &RootPath = TEXT(""));
+  UStaticMesh *
+  ImportRoseMesh(const FString &RelPath,
+                 const FRoseZSC::FMaterialEntry *M = nullptr,
+                 const FString &RootPath = TEXT(""),
+                 ERoseObjectSource Source = ERoseObjectSource::Any);
+
+  // Builds a new mesh from its description: lightmap UV and LOD/Nanite
+  // policy, then the fast or full build, then collision. bZMSLightmapUVs is
+  // true when UV channel 1 of MD is a usable lightmap layout. MeshPath is
+  // the ZMS the mesh was built from, empty for merged meshes.
+  void BuildNewRoseMesh(UStaticMesh *Mesh, FMeshDescription &MD,
+                        const FRoseZSC::FMaterialEntry *M,
+                        ERoseObjectSource Source, const FString &MeshPath,
+                        bool bZMSLightmapUVs);
+
+  // Sets where the mesh's lightmap channel comes from. Must run before
+  // ApplyMeshRenderPolicy, which copies LOD0 build settings to LODs.
+  void ApplyLightmapUVPolicy(UStaticMesh *Mesh, bool bZMSLightmapUVs);
+
+  // Merged mesh for a static multi-part object. PrebuildZoneMeshes builds
+  // the zone's prefabs up front; others are built here on first use.
+  FRoseResolvedPart *ResolvePrefab(const FRoseZSC &ZSC, int32 ObjectID,
+                                   ERoseObjectSource Source);
+
+  // True when the saved prefab mesh PN is older than one of its parts' ZMS
+  bool IsStalePrefab(const FRoseZSC &ZSC, const FRoseZSC::FObjectEntry &Object,
+                     const FString &PN);
+
+  // Creates simple collision for a new mesh from its description. The mesh
+  // is shared by every part placing its ZMS, so the strongest shape any of
+  // them asks for wins; parts without a ZSC collision mode ask for a box or
+  // convex hulls by mesh size and category. Source is the category of
+  // meshes no ZSC part describes (merged prefabs).
+  void SetupMeshCollision(UStaticMesh *Mesh, const FMeshDescription &MD,
+                          const FString &MeshPath, ERoseObjectSource Source);
+  const FRoseMeshCollisionUse *FindMeshCollisionUse(const FString &MeshPath);
+
+  // Adds a freshly built mesh's LOD chain to the import report
+  void RecordMeshLODs(const UStaticMesh *Mesh);
+
+  // Applies the Nanite or LOD policy to a new mesh before its build.
+  // Returns true when the mesh needs the full build (not
+  // BuildFromMeshDescriptions).
+  bool ApplyMeshRenderPolicy(UStaticMesh *Mesh,
+                             const FRoseZSC::FMaterialEntry *M,
+                             ERoseObjectSource Source, int32 NumTriangles);
 
   void UpdateMeshMaterial(UStaticMesh *Mesh, const FRoseZSC::FMaterialEntry *M);
 
+  // Finds or creates the material instance for a ZSC material entry
+  UMaterialInterface *
+  GetOrCreateMeshMaterial(const FRoseZSC::FMaterialEntry *M,
+                          bool bAnimWPO = false);
+
+  // Writes a clip's keys into /Game/Rose/Imported/AnimBakes/<AssetName>
+  UTexture2D *CreateAnimBakeTexture(const FString &AssetName,
+                                    const FRoseAnimClip &Clip);
+
+  // Material instance playing AnimTex on top of the part's ZSC material
+  UMaterialInterface *
+  GetOrCreateAnimWPOMaterial(const FRoseZSC::FMaterialEntry *M,
+                             UTexture2D *AnimTex);
+
+  // Builds every mesh referenced by the zone's IFOs up front: ZMS parsing and
+  // MeshDescription conversion run in parallel, render data is batch built.
+  void PrebuildZoneMeshes(const TArray<FRoseIFO> &IFOs);
+
   // FBX Helpers
   bool ExportMeshToFBX(UStaticMesh *Mesh, const FString &FBXPath);
   UStaticMesh *ImportFBXMesh(const FString &FBXPath, const FString &DestName);
@@ -234,9 +578,12 @@ private:
   // Helper to find or load existing skeleton
   USkeleton *FindOrLoadSkeleton(const FString &PackageName);
 
+  // bAnimatedOnly places just the animated parts (incremental re-import of
+  // a tile whose static objects are kept)
   void ProcessObjects(const FRoseIFO &IFO, UWorld *World,
                       const FVector &TileOffset, int32 MinX, int32 MinY,
-                      int32 ZoneWidth, int32 ZoneHeight);
+                      int32 ZoneWidth, int32 ZoneHeight,
+                      bool bAnimatedOnly = false);
 
   // TileSet Mapping Helpers
   UTexture2D *CreateTileMapDataTexture(const FRoseTIL &TIL, const FRoseZON &ZON,
@@ -244,23 +591,51 @@ private:
   bool GetBrushUVOffset(int32 TileID, int32 &OutU, int32 &OutV) const;
 
   void SpawnAnimatedObject(UStaticMesh *Mesh, const FTransform &Transform,
-                           const FString &AnimPath, UWorld *World);
+                           const FString &AnimPath, UWorld *World,
+                           const FIntPoint &Cell,
+                           const FRoseZSC::FMaterialEntry *MatEntry,
+                           const FString &MeshPath, float ObjectSize);
+
+  // Loads a ZMO once per import and returns its shared clip (null on error)
+  TSharedPtr<const FRoseAnimClip> GetAnimClip(const FString &FullAnimPath,
+                                              FString &OutClipKey);
+
+  // HISM partition cell for a placement, per URoseImportSettings
+  FIntPoint GetPartitionCell(const FRoseMapObject &MapObj,
+                             const FVector &Location) const;
+
+  // Actor that owns the HISMs of a partition cell (ZoneObjectsActor unless
+  // per-cell actors are enabled)
+  AActor *GetHISMOwner(const FIntPoint &Cell);
+
+  // Builds far-field proxies for the partition cells (bGenerateHLODs)
+  void BuildZoneHLODs(UWorld *World);
+  UHLODLayer *GetOrCreateHLODLayer();
+
+  // Derives the HISM key for a placed part from its mesh and ZSC material
+  FRoseHISMKey MakeHISMKey(UStaticMesh *Mesh, const FRoseZSC::FMaterialEntry *M,
+                           const FString &MeshPath) const;
 
   UHierarchicalInstancedStaticMeshComponent *
-  GetOrCreateHISM(UStaticMesh *Mesh, UMaterialInterface *Material);
+  GetOrCreateHISM(const FRoseHISMKey &Key, const FString &DebugCtx);
 
-  // Helper to save any asset to disk
-  bool SaveRoseAsset(UObject *Asset);
+  // Buffers an instance; nothing touches the component until the flush
+  void QueueHISMInstance(UHierarchicalInstancedStaticMeshComponent *HISM,
+                         const FTransform &Transform,
+                         TConstArrayView<float> CustomData = {});
 
-  // Cache to avoid redundant material saves
-  TSet<FString> ProcessedMaterialPaths;
+  // Adds all buffered instances with one AddInstances call per component and
+  // kicks a single async cluster tree build for each
+  void FlushHISMInstances();
 
-  // Texture Utils
+  // Marks an asset dirty and queues its package for the end-of-import save
+  bool SaveRoseAsset(UObject *Asset);
 
-  // Fast in-memory texture cache (avoids
-  // redundant DDS loads)
-  TMap<FString, UTexture2D *> TextureCache;
+  // Saves every queued package in one batch and notifies the asset registry
+  // once. Returns the number of packages written.
+  int32 FlushPendingSaves();
 
-  // Cache for ZMD->Skeleton index remapping
-  TArray<int32> CachedSkeletonRemap;
+  // Packages queued by SaveRoseAsset, keyed to their primary asset
+  UPROPERTY()
+  TMap<UPackage *, UObject *> PendingSaveAssets;
 };
@@ -32,7 +32,7 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetToolsModule.h"
 #include "Factories/Factory.h"
-#include "UObject/SavePackage.h"
+#include "Misc/ScopeExit.h"
 
 // Blueprint / Kismet
 #include "Engine/Blueprint.h"
@@ -43,6 +43,19 @@
 
 // --- SKELETON IMPORT ---
 USkeleton *URoseImporter::ImportSkeleton(const FString &Path) {
+  FString Name = FPaths::GetBaseFilename(Path) + TEXT("_Skeleton");
+  FString PackageName = TEXT("/Game/Rose/Imported/Characters/") + Name;
+
+  // Built earlier in this editor session from the same ZMD: reuse the
+  // skeleton and its remap without parsing the file again
+  if (TSharedPtr<const FRoseSkeletonBinding> Binding =
+          GetSession().FindSkeletonBinding(Path)) {
+    if (USkeleton *Existing = FindOrLoadSkeleton(PackageName)) {
+      SkeletonBinding = Binding;
+      return Existing;
+    }
+  }
+
   // 1. Load ZMD
   FRoseZMD ZMD;
   if (!ZMD.Load(Path)) {
@@ -50,9 +63,6 @@ USkeleton *URoseImporter::ImportSkeleton(const FString &Path) {
     return nullptr;
   }
 
-  FString Name = FPaths::GetBaseFilename(Path) + TEXT("_Skeleton");
-  FString PackageName = TEXT("/Game/Rose/Imported/Characters/") + Name;
-
   // Check existing
   if (USkeleton *Existing = FindOrLoadSkeleton(PackageName)) {
     return Existing;
@@ -85,6 +95,9 @@ USkeleton *URoseImporter::ImportSkeleton(const FString &Path) {
 
   FReferenceSkeletonModifier Modifier(Skeleton); // process
 
+  TSharedPtr<FRoseSkeletonBinding> Binding = MakeShared<FRoseSkeletonBinding>();
+  Binding->SourceTime = IFileManager::Get().GetTimeStamp(*Path);
+
   int32 OriginalBoneCount = ZMD.Bones.Num();
 
   // List of bones to process
@@ -191,7 +204,7 @@ USkeleton *URoseImporter::ImportSkeleton(const FString &Path) {
         FTransform WorldLHS = BoneTransform * ParentWorldLHS;
         WorldTransforms[i] = WorldLHS;
         // Store full world transform for rigid binding (rotation + translation)
-        BoneWorldTransformsLHS.Add(FName(*RoseBone.Name), WorldLHS);
+        Binding->BoneWorldTransformsLHS.Add(FName(*RoseBone.Name), WorldLHS);
 
         Modifier.Add(BoneInfo, BoneTransform);
 
@@ -298,13 +311,20 @@ USkeleton *URoseImporter::ImportSkeleton(const FString &Path) {
   SaveRoseAsset(Skeleton); // Use helper to save to disk
 
   // Update Cache
-  CachedSkeletonRemap = OldToNewIndex;
+  Binding->Remap = MoveTemp(OldToNewIndex);
   UE_LOG(LogRoseImporter, Log, TEXT("Cached Skeleton Remap for %d bones"),
-         CachedSkeletonRemap.Num());
+         Binding->Remap.Num());
+  SkeletonBinding = Binding;
+  GetSession().AddSkeletonBinding(Path, Binding);
 
   return Skeleton;
 }
 
+const FRoseSkeletonBinding &URoseImporter::GetSkeletonBinding() const {
+  static const FRoseSkeletonBinding Empty;
+  return SkeletonBinding ? *SkeletonBinding : Empty;
+}
+
 USkeleton *URoseImporter::FindOrLoadSkeleton(const FString &PackageName) {
   FString ObjectPath =
       PackageName + TEXT(".") + FPaths::GetBaseFilename(PackageName);
@@ -393,10 +413,58 @@ USkeletalMesh *URoseImporter::ImportSkeletalMesh(const FString &Path,
       MeshAttributes.GetVertexInstanceColors();
   // Skin Weights
 
-  // Create Vertices
+  auto VertexSkinWeights = MeshAttributes.GetVertexSkinWeights();
+  using FBoneWeight = UE::AnimationCore::FBoneWeight;
+
+  // Reserve everything up front: one instance per triangle corner
   int32 VertCount = ZMS.Vertices.Num();
+  int32 IndexCount = ZMS.Indices.Num() - ZMS.Indices.Num() % 3;
+  MeshDesc.ReserveNewVertices(VertCount);
+  MeshDesc.ReserveNewVertexInstances(IndexCount);
+  MeshDesc.ReserveNewTriangles(IndexCount / 3);
+  MeshDesc.ReserveNewPolygons(IndexCount / 3);
+  MeshDesc.ReserveNewEdges(IndexCount);
+
+  // Auto-Rigid Bind for 0-bone parts (FACE/HAIR), resolved once per mesh
+  int32 RigidBoneIndex = 0; // Default to Root
+  if (ZMS.BoneCount == 0) {
+    // Try to find Head for Face/Hair
+    bool bIsFaceOrHair = Path.Contains(TEXT("FACE"), ESearchCase::IgnoreCase) ||
+                         Path.Contains(TEXT("HAIR"), ESearchCase::IgnoreCase);
+
+    if (bIsFaceOrHair) {
+      int32 HeadIdx =
+          Skeleton->GetReferenceSkeleton().FindBoneIndex(FName("b1_head"));
+
+      if (HeadIdx == INDEX_NONE) {
+        UE_LOG(LogRoseImporter, Warning,
+               TEXT("Could not find bone 'b1_head' for Face/Hair. Trying "
+                    "'b1_neck'."));
+        HeadIdx =
+            Skeleton->GetReferenceSkeleton().FindBoneIndex(FName("b1_neck"));
+      }
+
+      if (HeadIdx != INDEX_NONE) {
+        RigidBoneIndex = HeadIdx;
+        UE_LOG(LogRoseImporter, Log,
+               TEXT("Rigid Binding Face/Hair to Bone %d (%s)"), HeadIdx,
+               *Skeleton->GetReferenceSkeleton()
+                    .GetBoneName(HeadIdx)
+                    .ToString());
+      } else {
+        UE_LOG(LogRoseImporter, Error,
+               TEXT("Could not find 'b1_head' OR 'b1_neck'. Binding to Root "
+                    "(Feet)."));
+      }
+    }
+  }
+
+  // Create Vertices
   TArray<FVertexID> VertexIDs;
-  VertexIDs.SetNum(VertCount);
+  VertexIDs.SetNumUninitialized(VertCount);
+
+  // At most four influences per ZMS vertex, so this never touches the heap
+  TArray<FBoneWeight, TInlineAllocator<4>> Weights;
 
   for (int32 i = 0; i < VertCount; ++i) {
     FVertexID VertID = MeshDesc.CreateVertex();
@@ -406,59 +474,14 @@ USkeletalMesh *URoseImporter::ImportSkeletalMesh(const FString &Path,
     // Pos.Y = -Pos.Y; // Align with Skeleton (ImportSkeleton does not flip Y)
     VertexPositions[VertID] = Pos;
 
-    // Weights
-    // Weights should be stored as BoneIndex/Weight pairs if possible, but
-    // MeshDescription uses VertexSkinWeights array of TArray<FSkinWeightPair>
-    // logic OR explicit attribute setter
-
-    // In UE5, we can use simpler vertex attributes API:
-    // Attributes().GetVertexSkinWeights().Set(VertID, Weights)
-
     // Weights
     // UE 5.x uses AnimationCore::FBoneWeight
-    auto VertexSkinWeights = MeshAttributes.GetVertexSkinWeights();
-
-    using FBoneWeight = UE::AnimationCore::FBoneWeight;
-    TArray<FBoneWeight> Weights;
+    Weights.Reset();
 
     FVector4f W = ZMS.Vertices[i].Weights;
     FIntVector4 Ind = ZMS.Vertices[i].Indices;
 
-    // Auto-Rigid Bind for 0-bone parts (FACE/HAIR)
     if (ZMS.BoneCount == 0) {
-      int32 RigidBoneIndex = 0; // Default to Root
-
-      // Try to find Head for Face/Hair
-      bool bIsFaceOrHair =
-          Path.Contains(TEXT("FACE"), ESearchCase::IgnoreCase) ||
-          Path.Contains(TEXT("HAIR"), ESearchCase::IgnoreCase);
-
-      if (bIsFaceOrHair) {
-        int32 HeadIdx =
-            Skeleton->GetReferenceSkeleton().FindBoneIndex(FName("b1_head"));
-
-        if (HeadIdx == INDEX_NONE) {
-          UE_LOG(LogRoseImporter, Warning,
-                 TEXT("Could not find bone 'b1_head' for Face/Hair. Trying "
-                      "'b1_neck'."));
-          HeadIdx =
-              Skeleton->GetReferenceSkeleton().FindBoneIndex(FName("b1_neck"));
-        }
-
-        if (HeadIdx != INDEX_NONE) {
-          RigidBoneIndex = HeadIdx;
-          UE_LOG(LogRoseImporter, Log,
-                 TEXT("Rigid Binding Face/Hair to Bone %d (%s)"), HeadIdx,
-                 *Skeleton->GetReferenceSkeleton()
-                      .GetBoneName(HeadIdx)
-                      .ToString());
-        } else {
-          UE_LOG(LogRoseImporter, Error,
-                 TEXT("Could not find 'b1_head' OR 'b1_neck'. Binding to Root "
-                      "(Feet)."));
-        }
-      }
-
       Weights.Add(FBoneWeight(RigidBoneIndex, 1.0f));
     } else {
       auto AddWeight = [&](int32 MeshLocalBoneIndex, float Weight) {
@@ -466,18 +489,13 @@ USkeletalMesh *URoseImporter::ImportSkeletalMesh(const FString &Path,
           int32 OriginalZMDIndex = ZMS.BoneIndices[MeshLocalBoneIndex];
           int32 GlobalBoneIndex = OriginalZMDIndex;
 
-          bool bRemapped = false;
           // Apply Remap if available
-          if (CachedSkeletonRemap.IsValidIndex(OriginalZMDIndex)) {
-            int32 RemappedIndex = CachedSkeletonRemap[OriginalZMDIndex];
+          if (GetSkeletonBinding().Remap.IsValidIndex(OriginalZMDIndex)) {
+            int32 RemappedIndex = GetSkeletonBinding().Remap[OriginalZMDIndex];
             if (RemappedIndex != INDEX_NONE) {
               GlobalBoneIndex = RemappedIndex;
-              bRemapped = true;
             }
           }
-          if (!bRemapped && GlobalBoneIndex == 0 && OriginalZMDIndex != 0) {
-            // Warning suppressed
-          }
 
           Weights.Add(FBoneWeight(GlobalBoneIndex, Weight));
         }
@@ -579,14 +597,7 @@ USkeletalMesh *URoseImporter::ImportSkeletalMesh(const FString &Path,
           }
 
           MIC->PostEditChange();
-          FAssetRegistryModule::AssetCreated(MIC);
-          // Save
-          FString PackageFileName = FPackageName::LongPackageNameToFilename(
-              MatPackageName, FPackageName::GetAssetPackageExtension());
-          FSavePackageArgs SaveArgs;
-          SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-          SaveArgs.SaveFlags = SAVE_NoError;
-          UPackage::SavePackage(MatPkg, MIC, *PackageFileName, SaveArgs);
+          SaveRoseAsset(MIC);
         }
       }
       if (MIC) {
@@ -599,11 +610,13 @@ USkeletalMesh *URoseImporter::ImportSkeletalMesh(const FString &Path,
   }
 
   // Faces / Triangles
-  int32 IndexCount = ZMS.Indices.Num();
   for (int32 i = 0; i < IndexCount; i += 3) {
     uint32 I0 = ZMS.Indices[i];
     uint32 I1 = ZMS.Indices[i + 1];
     uint32 I2 = ZMS.Indices[i + 2];
+    if (I0 >= (uint32)VertCount || I1 >= (uint32)VertCount ||
+        I2 >= (uint32)VertCount)
+      continue;
 
     FVertexInstanceID VI0 = MeshDesc.CreateVertexInstance(VertexIDs[I0]);
     FVertexInstanceID VI1 = MeshDesc.CreateVertexInstance(VertexIDs[I1]);
@@ -716,6 +729,11 @@ URoseImporter::ImportUnifiedCharacter(const TArray<FString> &PartPaths,
 
   int32 MaterialSlotOffset = 0;
 
+  // Geometry conversion cost, logged once all parts are merged
+  double GeometrySeconds = 0.0;
+  int32 TotalVerts = 0;
+  int32 TotalTris = 0;
+
   // Iterate through all parts and merge
   for (const FString &Path : PartPaths) {
     FRoseZMS ZMS;
@@ -784,14 +802,7 @@ URoseImporter::ImportUnifiedCharacter(const TArray<FString> &PartPaths,
                 FMaterialParameterInfo(TEXT("AlphaRef")), 0.5f);
           }
           MIC->PostEditChange();
-          FAssetRegistryModule::AssetCreated(MIC);
-          // Save Material
-          FString PackageFileName = FPackageName::LongPackageNameToFilename(
-              MatPkgName, FPackageName::GetAssetPackageExtension());
-          FSavePackageArgs SaveArgs;
-          SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-          SaveArgs.SaveFlags = SAVE_NoError;
-          UPackage::SavePackage(MatPkg, MIC, *PackageFileName, SaveArgs);
+          SaveRoseAsset(MIC);
         }
       }
     }
@@ -807,18 +818,52 @@ URoseImporter::ImportUnifiedCharacter(const TArray<FString> &PartPaths,
     }
 
     FPolygonGroupID PolyGroupID = MeshDesc.CreatePolygonGroup();
-    FStaticMeshAttributes(MeshDesc)
-        .GetPolygonGroupMaterialSlotNames()[PolyGroupID] = SlotName;
+    MeshAttributes.GetPolygonGroupMaterialSlotNames()[PolyGroupID] = SlotName;
 
     // -- GEOMETRY MERGING --
-    TArray<FVertexID> LocalVertexIDs;
+    const double GeometryStart = FPlatformTime::Seconds();
     int32 VertCount = ZMS.Vertices.Num();
-    LocalVertexIDs.SetNum(VertCount);
+    int32 IndexCount = ZMS.Indices.Num() - ZMS.Indices.Num() % 3;
+    MeshDesc.ReserveNewVertices(VertCount);
+    MeshDesc.ReserveNewVertexInstances(IndexCount);
+    MeshDesc.ReserveNewTriangles(IndexCount / 3);
+    MeshDesc.ReserveNewPolygons(IndexCount / 3);
+    MeshDesc.ReserveNewEdges(IndexCount);
 
-    // Debug Head Bone Index
-    int32 DebugHeadIdx = RefSkeleton.FindBoneIndex(FName("b1_head"));
-    UE_LOG(LogRoseImporter, Log, TEXT("DEBUG: b1_head Index = %d"),
-           DebugHeadIdx);
+    TArray<FVertexID> LocalVertexIDs;
+    LocalVertexIDs.SetNumUninitialized(VertCount);
+
+    // Auto-Rigid Bind Logic, resolved once per part
+    bool bIsRigid = ZMS.BoneCount == 0 ||
+                    (Path.Contains(TEXT("FACE"), ESearchCase::IgnoreCase) ||
+                     Path.Contains(TEXT("HAIR"), ESearchCase::IgnoreCase));
+
+    int32 RigidBoneIdx = 0;
+    FTransform BoneWorldT = FTransform::Identity;
+
+    if (bIsRigid) {
+      RigidBoneIdx = RefSkeleton.FindBoneIndex(FName("b1_head"));
+      if (RigidBoneIdx == INDEX_NONE)
+        RigidBoneIdx = RefSkeleton.FindBoneIndex(FName("b1_neck"));
+      if (RigidBoneIdx == INDEX_NONE)
+        RigidBoneIdx = 0;
+
+      // Use stored ROSE world transforms for face/hair
+      // (applies both rotation and translation to fix head orientation)
+      FName BoneName = RefSkeleton.GetBoneName(RigidBoneIdx);
+      if (const FTransform *Found =
+              GetSkeletonBinding().BoneWorldTransformsLHS.Find(BoneName)) {
+        BoneWorldT = *Found;
+      }
+
+      UE_LOG(LogRoseImporter, Verbose,
+             TEXT("[Char] Rigid part %s bound to %s (%d) at %s"), *Path,
+             *BoneName.ToString(), RigidBoneIdx,
+             *BoneWorldT.GetTranslation().ToString());
+    }
+
+    // At most four influences per ZMS vertex, so this never touches the heap
+    TArray<FBoneWeight, TInlineAllocator<4>> Weights;
 
     for (int32 i = 0; i < VertCount; ++i) {
       FVertexID VertID = MeshDesc.CreateVertex();
@@ -828,62 +873,16 @@ URoseImporter::ImportUnifiedCharacter(const TArray<FString> &PartPaths,
       FVector3f Pos = ZMS.Vertices[i].Position * 100.0f;
       Pos.Y = -Pos.Y; // RH -> LH conversion
 
-      FVector3f Normal =
-          FVector3f(ZMS.Vertices[i].Normal.X, -ZMS.Vertices[i].Normal.Y,
-                    ZMS.Vertices[i].Normal.Z);
-
-      // Auto-Rigid Bind Logic
-      bool bIsRigid = ZMS.BoneCount == 0 ||
-                      (Path.Contains(TEXT("FACE"), ESearchCase::IgnoreCase) ||
-                       Path.Contains(TEXT("HAIR"), ESearchCase::IgnoreCase));
-
-      int32 RigidBoneIdx = 0;
-
       if (bIsRigid) {
-        RigidBoneIdx = RefSkeleton.FindBoneIndex(FName("b1_head"));
-        if (RigidBoneIdx == INDEX_NONE)
-          RigidBoneIdx = RefSkeleton.FindBoneIndex(FName("b1_neck"));
-        if (RigidBoneIdx == INDEX_NONE)
-          RigidBoneIdx = 0;
-
-        // Use stored ROSE world transforms for face/hair
-        // (applies both rotation and translation to fix head orientation)
-        FName BoneName = RefSkeleton.GetBoneName(RigidBoneIdx);
-        FTransform BoneWorldT = FTransform::Identity;
-        if (FTransform *Found = BoneWorldTransformsLHS.Find(BoneName)) {
-          BoneWorldT = *Found;
-        }
-
-        // DEBUG: Log once per mesh part
-        if (i == 0) {
-          FVector BonePos = BoneWorldT.GetTranslation();
-          UE_LOG(LogRoseImporter, Warning,
-                 TEXT("RIGID DEBUG: Path=%s, bIsRigid=true, RigidBoneIdx=%d, "
-                      "BoneName=%s"),
-                 *Path, RigidBoneIdx, *BoneName.ToString());
-          UE_LOG(LogRoseImporter, Warning,
-                 TEXT("RIGID DEBUG: BoneWorldPos LHS=(%f, %f, %f)"), BonePos.X,
-                 BonePos.Y, BonePos.Z);
-          UE_LOG(LogRoseImporter, Warning,
-                 TEXT("RIGID DEBUG: Pos BEFORE transform=(%f, %f, %f)"), Pos.X,
-                 Pos.Y, Pos.Z);
-        }
-
         // Apply full bone world transform (rotate + translate)
         FVector TransformedPos = BoneWorldT.TransformPosition(FVector(Pos));
         Pos = (FVector3f)TransformedPos;
-
-        if (i == 0) {
-          UE_LOG(LogRoseImporter, Warning,
-                 TEXT("RIGID DEBUG: Pos AFTER transform=(%f, %f, %f)"), Pos.X,
-                 Pos.Y, Pos.Z);
-        }
       }
 
       VertexPositions[VertID] = Pos;
 
       // Weights
-      TArray<FBoneWeight> Weights;
+      Weights.Reset();
       FVector4f W = ZMS.Vertices[i].Weights;
       FIntVector4 Ind = ZMS.Vertices[i].Indices;
 
@@ -897,8 +896,8 @@ URoseImporter::ImportUnifiedCharacter(const TArray<FString> &PartPaths,
             int32 GlobalBoneIndex = OrigBoneIdx;
 
             // Apply Cached Remap
-            if (CachedSkeletonRemap.IsValidIndex(OrigBoneIdx)) {
-              int32 Remapped = CachedSkeletonRemap[OrigBoneIdx];
+            if (GetSkeletonBinding().Remap.IsValidIndex(OrigBoneIdx)) {
+              int32 Remapped = GetSkeletonBinding().Remap[OrigBoneIdx];
               if (Remapped != INDEX_NONE) {
                 GlobalBoneIndex = Remapped;
               }
@@ -916,11 +915,13 @@ URoseImporter::ImportUnifiedCharacter(const TArray<FString> &PartPaths,
     }
 
     // Triangles
-    int32 IndexCount = ZMS.Indices.Num();
     for (int32 i = 0; i < IndexCount; i += 3) {
       uint32 I0 = ZMS.Indices[i];
       uint32 I1 = ZMS.Indices[i + 1];
       uint32 I2 = ZMS.Indices[i + 2];
+      if (I0 >= (uint32)VertCount || I1 >= (uint32)VertCount ||
+          I2 >= (uint32)VertCount)
+        continue;
 
       FVertexInstanceID VI0 = MeshDesc.CreateVertexInstance(LocalVertexIDs[I0]);
       FVertexInstanceID VI1 = MeshDesc.CreateVertexInstance(LocalVertexIDs[I1]);
@@ -930,20 +931,10 @@ URoseImporter::ImportUnifiedCharacter(const TArray<FString> &PartPaths,
       const auto &V1 = ZMS.Vertices[I1];
       const auto &V2 = ZMS.Vertices[I2];
 
-      bool bIsRigid = ZMS.BoneCount == 0 ||
-                      (Path.Contains(TEXT("FACE"), ESearchCase::IgnoreCase) ||
-                       Path.Contains(TEXT("HAIR"), ESearchCase::IgnoreCase));
-
-      if (bIsRigid) {
-        // Same Y-flip as non-rigid (matches working static mesh import)
-        VertexNormals[VI0] = FVector3f(V0.Normal.X, -V0.Normal.Y, V0.Normal.Z);
-        VertexNormals[VI1] = FVector3f(V1.Normal.X, -V1.Normal.Y, V1.Normal.Z);
-        VertexNormals[VI2] = FVector3f(V2.Normal.X, -V2.Normal.Y, V2.Normal.Z);
-      } else {
-        VertexNormals[VI0] = FVector3f(V0.Normal.X, -V0.Normal.Y, V0.Normal.Z);
-        VertexNormals[VI1] = FVector3f(V1.Normal.X, -V1.Normal.Y, V1.Normal.Z);
-        VertexNormals[VI2] = FVector3f(V2.Normal.X, -V2.Normal.Y, V2.Normal.Z);
-      }
+      // Same Y-flip for rigid and skinned parts (matches static mesh import)
+      VertexNormals[VI0] = FVector3f(V0.Normal.X, -V0.Normal.Y, V0.Normal.Z);
+      VertexNormals[VI1] = FVector3f(V1.Normal.X, -V1.Normal.Y, V1.Normal.Z);
+      VertexNormals[VI2] = FVector3f(V2.Normal.X, -V2.Normal.Y, V2.Normal.Z);
 
       VertexUVs[VI0] = V0.UV1;
       VertexUVs[VI1] = V1.UV1;
@@ -953,9 +944,17 @@ URoseImporter::ImportUnifiedCharacter(const TArray<FString> &PartPaths,
       MeshDesc.CreateTriangle(PolyGroupID, {VI0, VI1, VI2});
     }
 
+    GeometrySeconds += FPlatformTime::Seconds() - GeometryStart;
+    TotalVerts += VertCount;
+    TotalTris += IndexCount / 3;
     MaterialSlotOffset++;
   }
 
+  UE_LOG(LogRoseImporter, Log,
+         TEXT("[Char] Mesh description: %d vertices, %d triangles from %d "
+              "parts in %.2f ms"),
+         TotalVerts, TotalTris, MaterialSlotOffset, GeometrySeconds * 1000.0);
+
   SkeletalMesh->CreateMeshDescription(0, MoveTemp(MeshDesc));
   SkeletalMesh->CommitMeshDescription(0);
   SkeletalMesh->PostEditChange();
@@ -1002,8 +1001,8 @@ UAnimSequence *URoseImporter::ImportAnimation(const FString &Path,
     int32 TargetBoneIndex = Chan.BoneID;
 
     // Apply Cached Remap
-    if (CachedSkeletonRemap.IsValidIndex(Chan.BoneID)) {
-      int32 Remapped = CachedSkeletonRemap[Chan.BoneID];
+    if (GetSkeletonBinding().Remap.IsValidIndex(Chan.BoneID)) {
+      int32 Remapped = GetSkeletonBinding().Remap[Chan.BoneID];
       if (Remapped != INDEX_NONE) {
         TargetBoneIndex = Remapped;
       } else {
@@ -1214,11 +1213,18 @@ void URoseImporter::ImportDefaultCharacter(const FString &ZMDPath) {
   UE_LOG(LogRoseImporter, Log, TEXT("Importing Default Character from ZMD: %s"),
          *ZMDPath);
 
+  // Skeleton, mesh and material packages are written together at the end
+  ON_SCOPE_EXIT {
+    FlushPendingSaves();
+    GetSession().LogStats();
+  };
+
   FString AbsZMDPath =
       IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*ZMDPath);
   FString AvatarDir = FPaths::GetPath(AbsZMDPath);
   FString ThreeDDataDir = FPaths::GetPath(AvatarDir);
   this->RoseRootPath = FPaths::GetPath(ThreeDDataDir);
+  GetSession().BeginImport(RoseRootPath);
 
   UE_LOG(LogRoseImporter, Log, TEXT("AvatarDir: %s"), *AvatarDir);
 
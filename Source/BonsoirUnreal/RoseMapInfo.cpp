@@ -1 +1,6 @@
 #include "RoseMapInfo.h"
+
+const FRoseTileManifest *URoseMapInfo::FindTile(const FIntPoint &Tile) const {
+  return Tiles.FindByPredicate(
+      [&Tile](const FRoseTileManifest &Entry) { return Entry.Tile == Tile; });
+}
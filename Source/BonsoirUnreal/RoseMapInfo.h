@@ -3,6 +3,34 @@
 #include "CoreMinimal.h"
 #include "RoseMapInfo.generated.h"
 
+/**
+ * Inputs and partition cells of one imported tile. A re-import compares
+ * them to decide which tiles it has to rebuild.
+ */
+USTRUCT()
+struct FRoseTileManifest {
+  GENERATED_BODY()
+
+  UPROPERTY(VisibleAnywhere, Category = "Rose Import")
+  FIntPoint Tile = FIntPoint::ZeroValue;
+
+  // MD5 of the tile's HIM, TIL and IFO files
+  UPROPERTY(VisibleAnywhere, Category = "Rose Import")
+  FString HIMHash;
+  UPROPERTY(VisibleAnywhere, Category = "Rose Import")
+  FString TILHash;
+  UPROPERTY(VisibleAnywhere, Category = "Rose Import")
+  FString IFOHash;
+
+  // ZMS and texture files used by the tile's objects (SourceHashes keys)
+  UPROPERTY(VisibleAnywhere, Category = "Rose Import")
+  TArray<FString> Sources;
+
+  // Partition cells the tile's objects were placed in
+  UPROPERTY(VisibleAnywhere, Category = "Rose Import")
+  TArray<FIntPoint> Cells;
+};
+
 /**
  * Stores information about an imported ROSE Online Zone.
  */
@@ -14,4 +42,18 @@ public:
   // Path to the original .ZON file
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Rose Import")
   FString OriginalZONPath;
+
+  // Hash of the ZON and ZSC files and the importer settings. Any change
+  // makes the next import a full one
+  UPROPERTY(VisibleAnywhere, Category = "Rose Import")
+  FString ZoneHash;
+
+  UPROPERTY(VisibleAnywhere, Category = "Rose Import")
+  TArray<FRoseTileManifest> Tiles;
+
+  // MD5 of every ZMS and texture source, by normalized file path
+  UPROPERTY(VisibleAnywhere, Category = "Rose Import")
+  TMap<FString, FString> SourceHashes;
+
+  const FRoseTileManifest *FindTile(const FIntPoint &Tile) const;
 };
@@ -0,0 +1,311 @@
+#include "RoseMeshOptimizer.h"
+#include "RoseFormats.h"
+
+namespace {
+
+// Scoring constants from Tom Forsyth's "Linear-Speed Vertex Cache
+// Optimisation"
+constexpr int32 ForsythCacheSize = 32;
+constexpr float ForsythCacheDecayPower = 1.5f;
+constexpr float ForsythLastTriScore = 0.75f;
+constexpr float ForsythValenceBoostScale = 2.0f;
+constexpr float ForsythValenceBoostPower = 0.5f;
+
+// Non-position attributes only weld when (almost) identical
+constexpr float WeldNormalTolerance = 1e-3f;
+constexpr float WeldUVTolerance = 1e-5f;
+constexpr float WeldWeightTolerance = 1e-4f;
+
+float ForsythVertexScore(int32 CachePos, int32 RemainingTris) {
+  if (RemainingTris == 0)
+    return -1.0f;
+
+  float Score = 0.0f;
+  if (CachePos >= 0) {
+    if (CachePos < 3) {
+      // Vertices of the last triangle: fixed score, so a neighbour is not
+      // always preferred over slightly older cache entries
+      Score = ForsythLastTriScore;
+    } else {
+      const float Scaler = 1.0f / (ForsythCacheSize - 3);
+      Score = FMath::Pow(1.0f - (CachePos - 3) * Scaler,
+                         ForsythCacheDecayPower);
+    }
+  }
+
+  // Favour vertices with few triangles left so they get finished off
+  Score += ForsythValenceBoostScale *
+           FMath::Pow((float)RemainingTris, -ForsythValenceBoostPower);
+  return Score;
+}
+
+bool VerticesMatch(const FRoseZMS::FVertex &A, const FRoseZMS::FVertex &B,
+                   float PositionTolerance) {
+  return A.Position.Equals(B.Position, PositionTolerance) &&
+         A.Normal.Equals(B.Normal, WeldNormalTolerance) &&
+         A.UV1.Equals(B.UV1, WeldUVTolerance) &&
+         A.UV2.Equals(B.UV2, WeldUVTolerance) &&
+         A.UV3.Equals(B.UV3, WeldUVTolerance) &&
+         A.UV4.Equals(B.UV4, WeldUVTolerance) && A.Color == B.Color &&
+         A.Weights.Equals(B.Weights, WeldWeightTolerance) &&
+         A.Indices == B.Indices;
+}
+
+} // namespace
+
+void FRoseMeshOptimizeStats::Accumulate(const FRoseMeshOptimizeStats &Other) {
+  VertsBefore += Other.VertsBefore;
+  VertsAfter += Other.VertsAfter;
+  TrisBefore += Other.TrisBefore;
+  TrisAfter += Other.TrisAfter;
+  MissesBefore += Other.MissesBefore;
+  MissesAfter += Other.MissesAfter;
+  Seconds += Other.Seconds;
+}
+
+int32 RoseMeshOptimizer::CountCacheMisses(TConstArrayView<uint32> Indices,
+                                          int32 CacheSize) {
+  uint32 MaxIndex = 0;
+  for (uint32 Index : Indices) {
+    MaxIndex = FMath::Max(MaxIndex, Index);
+  }
+
+  // A vertex is cached while fewer than CacheSize misses happened since
+  // it was loaded (FIFO replacement)
+  TArray<int32> LoadedAt;
+  LoadedAt.Init(INDEX_NONE, Indices.Num() > 0 ? MaxIndex + 1 : 0);
+  int32 Misses = 0;
+  for (uint32 Index : Indices) {
+    if (LoadedAt[Index] == INDEX_NONE ||
+        Misses - LoadedAt[Index] >= CacheSize) {
+      LoadedAt[Index] = Misses++;
+    }
+  }
+  return Misses;
+}
+
+TArray<uint32> RoseMeshOptimizer::WeldVertices(const FRoseZMS &ZMS,
+                                               float WeldThreshold,
+                                               int32 &OutNumUnique) {
+  const int32 NumVerts = ZMS.Vertices.Num();
+  TArray<uint32> Remap;
+  Remap.SetNumUninitialized(NumVerts);
+
+  // Bucket by quantized position. Near-equal vertices on either side of a
+  // bucket edge stay separate, which only costs a duplicate
+  const float CellSize = FMath::Max(WeldThreshold, KINDA_SMALL_NUMBER);
+  TMultiMap<FIntVector, int32> Buckets;
+  Buckets.Reserve(NumVerts);
+  TArray<int32> Unique; // Source vertex of each unique vertex
+  Unique.Reserve(NumVerts);
+  TArray<int32, TInlineAllocator<8>> Candidates;
+
+  for (int32 i = 0; i < NumVerts; ++i) {
+    const FRoseZMS::FVertex &V = ZMS.Vertices[i];
+    const FIntVector Cell(FMath::FloorToInt(V.Position.X / CellSize),
+                          FMath::FloorToInt(V.Position.Y / CellSize),
+                          FMath::FloorToInt(V.Position.Z / CellSize));
+
+    Candidates.Reset();
+    Buckets.MultiFind(Cell, Candidates);
+    int32 Match = INDEX_NONE;
+    for (int32 U : Candidates) {
+      if (VerticesMatch(ZMS.Vertices[Unique[U]], V, WeldThreshold)) {
+        Match = U;
+        break;
+      }
+    }
+    if (Match == INDEX_NONE) {
+      Match = Unique.Add(i);
+      Buckets.Add(Cell, Match);
+    }
+    Remap[i] = Match;
+  }
+
+  OutNumUnique = Unique.Num();
+  return Remap;
+}
+
+void RoseMeshOptimizer::OptimizeVertexCache(TArray<uint32> &Indices,
+                                            int32 NumVerts) {
+  const int32 NumTris = Indices.Num() / 3;
+  if (NumTris == 0)
+    return;
+
+  // Triangles per vertex, packed. The first Remaining[V] entries of a
+  // vertex's range are the triangles not emitted yet
+  TArray<int32> Remaining;
+  Remaining.SetNumZeroed(NumVerts);
+  for (uint32 Index : Indices) {
+    Remaining[Index]++;
+  }
+  TArray<int32> AdjStart;
+  AdjStart.SetNumUninitialized(NumVerts + 1);
+  AdjStart[0] = 0;
+  for (int32 V = 0; V < NumVerts; ++V) {
+    AdjStart[V + 1] = AdjStart[V] + Remaining[V];
+  }
+  TArray<int32> Adj;
+  Adj.SetNumUninitialized(Indices.Num());
+  TArray<int32> Fill(AdjStart.GetData(), NumVerts);
+  for (int32 i = 0; i < Indices.Num(); ++i) {
+    Adj[Fill[Indices[i]]++] = i / 3;
+  }
+
+  TArray<int32> CachePos;
+  CachePos.Init(INDEX_NONE, NumVerts);
+  TArray<float> VertScore;
+  VertScore.SetNumUninitialized(NumVerts);
+  for (int32 V = 0; V < NumVerts; ++V) {
+    VertScore[V] = ForsythVertexScore(INDEX_NONE, Remaining[V]);
+  }
+
+  TArray<float> TriScore;
+  TriScore.SetNumUninitialized(NumTris);
+  int32 BestTri = 0;
+  for (int32 t = 0; t < NumTris; ++t) {
+    TriScore[t] = VertScore[Indices[t * 3]] + VertScore[Indices[t * 3 + 1]] +
+                  VertScore[Indices[t * 3 + 2]];
+    if (TriScore[t] > TriScore[BestTri]) {
+      BestTri = t;
+    }
+  }
+
+  TArray<bool> Emitted;
+  Emitted.Init(false, NumTris);
+  TArray<uint32> Out;
+  Out.Reserve(Indices.Num());
+  TArray<int32, TInlineAllocator<ForsythCacheSize + 3>> Cache, NewCache;
+  int32 ScanCursor = 0;
+
+  for (int32 Emit = 0; Emit < NumTris; ++Emit) {
+    if (BestTri == INDEX_NONE) {
+      // No cached vertex has live triangles left: start a new strip
+      while (Emitted[ScanCursor]) {
+        ++ScanCursor;
+      }
+      BestTri = ScanCursor;
+    }
+
+    Emitted[BestTri] = true;
+    NewCache.Reset();
+    for (int32 k = 0; k < 3; ++k) {
+      const uint32 V = Indices[BestTri * 3 + k];
+      Out.Add(V);
+      NewCache.AddUnique(V);
+
+      // Swap the triangle out of V's live range
+      int32 *Tris = &Adj[AdjStart[V]];
+      const int32 Last = --Remaining[V];
+      for (int32 j = 0; j <= Last; ++j) {
+        if (Tris[j] == BestTri) {
+          Swap(Tris[j], Tris[Last]);
+          break;
+        }
+      }
+    }
+    for (int32 V : Cache) {
+      NewCache.AddUnique(V);
+    }
+
+    // Rescore everything that moved in or out of the cache
+    for (int32 i = 0; i < NewCache.Num(); ++i) {
+      const int32 V = NewCache[i];
+      CachePos[V] = i < ForsythCacheSize ? i : INDEX_NONE;
+      const float Score = ForsythVertexScore(CachePos[V], Remaining[V]);
+      const float Delta = Score - VertScore[V];
+      VertScore[V] = Score;
+      for (int32 j = 0; j < Remaining[V]; ++j) {
+        TriScore[Adj[AdjStart[V] + j]] += Delta;
+      }
+    }
+
+    // The next triangle is the best one touching the cache
+    BestTri = INDEX_NONE;
+    float BestScore = -1.0f;
+    NewCache.SetNum(FMath::Min(NewCache.Num(), ForsythCacheSize));
+    for (int32 V : NewCache) {
+      for (int32 j = 0; j < Remaining[V]; ++j) {
+        const int32 T = Adj[AdjStart[V] + j];
+        if (TriScore[T] > BestScore) {
+          BestScore = TriScore[T];
+          BestTri = T;
+        }
+      }
+    }
+    Swap(Cache, NewCache);
+  }
+
+  Indices = MoveTemp(Out);
+}
+
+void RoseMeshOptimizer::Optimize(FRoseZMS &ZMS, float WeldThreshold,
+                                 FRoseMeshOptimizeStats *OutStats) {
+  const double StartTime = FPlatformTime::Seconds();
+  const int32 NumVerts = ZMS.Vertices.Num();
+
+  TArray<uint32> Indices = ZMS.Indices;
+  for (uint32 Index : Indices) {
+    if (Index >= (uint32)NumVerts) {
+      return; // Broken index buffer; leave it to the mesh build to report
+    }
+  }
+
+  FRoseMeshOptimizeStats Stats;
+  Stats.VertsBefore = NumVerts;
+  Stats.TrisBefore = Indices.Num() / 3;
+  Stats.MissesBefore = CountCacheMisses(Indices);
+
+  int32 NumUnique = 0;
+  const TArray<uint32> Remap = WeldVertices(ZMS, WeldThreshold, NumUnique);
+
+  // Remap to welded vertices and drop triangles that collapsed
+  int32 NumIndices = 0;
+  for (int32 i = 0; i + 2 < Indices.Num(); i += 3) {
+    const uint32 A = Remap[Indices[i]];
+    const uint32 B = Remap[Indices[i + 1]];
+    const uint32 C = Remap[Indices[i + 2]];
+    if (A == B || B == C || A == C)
+      continue;
+    Indices[NumIndices++] = A;
+    Indices[NumIndices++] = B;
+    Indices[NumIndices++] = C;
+  }
+  Indices.SetNum(NumIndices);
+  if (Indices.Num() == 0)
+    return;
+
+  OptimizeVertexCache(Indices, NumUnique);
+
+  // Number vertices in first-use order so fetches walk forward through
+  // the vertex buffer; unreferenced vertices are dropped
+  TArray<int32> Source;
+  Source.Init(INDEX_NONE, NumUnique);
+  for (int32 i = NumVerts - 1; i >= 0; --i) {
+    Source[Remap[i]] = i;
+  }
+  TArray<int32> NewIndex;
+  NewIndex.Init(INDEX_NONE, NumUnique);
+  TArray<FRoseZMS::FVertex> Vertices;
+  Vertices.Reserve(NumUnique);
+  for (uint32 &Index : Indices) {
+    int32 &Mapped = NewIndex[Index];
+    if (Mapped == INDEX_NONE) {
+      Mapped = Vertices.Add(ZMS.Vertices[Source[Index]]);
+    }
+    Index = Mapped;
+  }
+
+  ZMS.Vertices = MoveTemp(Vertices);
+  ZMS.VertCount = ZMS.Vertices.Num();
+  ZMS.FaceCount = Indices.Num() / 3;
+
+  Stats.VertsAfter = ZMS.VertCount;
+  Stats.TrisAfter = ZMS.FaceCount;
+  Stats.MissesAfter = CountCacheMisses(Indices);
+  ZMS.Indices = MoveTemp(Indices);
+  Stats.Seconds = FPlatformTime::Seconds() - StartTime;
+  if (OutStats) {
+    *OutStats = Stats;
+  }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FRoseZMS;
+
+/**
+ * Before/after figures for one optimized mesh. ACMR is the average number
+ * of vertex cache misses per triangle, simulated with a FIFO cache.
+ */
+struct FRoseMeshOptimizeStats {
+  int32 VertsBefore = 0;
+  int32 VertsAfter = 0;
+  int32 TrisBefore = 0;
+  int32 TrisAfter = 0;
+  int32 MissesBefore = 0;
+  int32 MissesAfter = 0;
+  double Seconds = 0.0;
+
+  float GetACMRBefore() const {
+    return TrisBefore > 0 ? (float)MissesBefore / TrisBefore : 0.0f;
+  }
+  float GetACMRAfter() const {
+    return TrisAfter > 0 ? (float)MissesAfter / TrisAfter : 0.0f;
+  }
+
+  void Accumulate(const FRoseMeshOptimizeStats &Other);
+};
+
+namespace RoseMeshOptimizer {
+
+// Cache size used for the ACMR figures (typical post-transform cache)
+constexpr int32 ACMRCacheSize = 16;
+
+// Vertex cache misses when drawing Indices through a FIFO cache
+int32 CountCacheMisses(TConstArrayView<uint32> Indices,
+                       int32 CacheSize = ACMRCacheSize);
+
+// Merges vertices whose attributes all match; positions within
+// WeldThreshold (ZMS units) count as equal. Returns the index remap and
+// writes the unique vertex count to OutNumUnique.
+TArray<uint32> WeldVertices(const FRoseZMS &ZMS, float WeldThreshold,
+                            int32 &OutNumUnique);
+
+// Reorders triangles for the post-transform vertex cache (Forsyth)
+void OptimizeVertexCache(TArray<uint32> &Indices, int32 NumVerts);
+
+// Welds, drops degenerate triangles, reorders triangles for the vertex
+// cache and then vertices for fetch locality. Pure CPU work on ZMS data,
+// safe to run on worker threads.
+void Optimize(FRoseZMS &ZMS, float WeldThreshold,
+              FRoseMeshOptimizeStats *OutStats = nullptr);
+
+} // namespace RoseMeshOptimizer
@@ -1,5 +1,6 @@
 #include "RoseZoneFactory.h"
 #include "Misc/Paths.h"
+#include "RoseImportSession.h"
 #include "RoseImporter.h"
 #include "RoseMapInfo.h"
 #include "SRoseZoneBrowser.h"
@@ -43,15 +44,17 @@ UObject *URoseZoneFactory::FactoryCreateFile(UClass *InClass, UObject *InParent,
 
   // Handle LIST_ZONE.STB selection
   if (Ext == TEXT("stb")) {
-    FRoseSTB Stb;
-    if (!Stb.Load(Filename)) {
+    URoseImportSession *Session = URoseImportSession::Get();
+    TSharedPtr<const FRoseSTB> Stb =
+        Session ? Session->GetSTB(Filename) : nullptr;
+    if (!Stb) {
       UE_LOG(LogTemp, Error, TEXT("Failed to load STB: %s"), *Filename);
       bOutOperationCanceled = true;
       return nullptr;
     }
 
     // Open Browser
-    TSharedPtr<FZoneRow> Selected = SRoseZoneBrowser::PickZone(Stb);
+    TSharedPtr<FZoneRow> Selected = SRoseZoneBrowser::PickZone(*Stb);
     if (!Selected.IsValid()) {
       bOutOperationCanceled = true;
       return nullptr;
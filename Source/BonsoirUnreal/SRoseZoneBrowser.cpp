@@ -81,7 +81,8 @@ TSharedPtr<FZoneRow> SRoseZoneBrowser::PickZone(const FRoseSTB &StbData) {
     for (int32 c = 0; c < StbData.GetColumnCount(); ++c) {
       // Check first few data rows (skip header 0)
       for (int32 r = 1; r < FMath::Min(10, StbData.GetRowCount()); ++r) {
-        if (StbData.GetCell(r, c).ToLower().EndsWith(".zon")) {
+        if (StbData.GetCellView(r, c).EndsWith(FAnsiStringView(".zon"),
+                                               ESearchCase::IgnoreCase)) {
           ZonCol = c;
           goto FoundZonCol; // Break out of nested loop
         }
@@ -90,7 +91,8 @@ TSharedPtr<FZoneRow> SRoseZoneBrowser::PickZone(const FRoseSTB &StbData) {
 
     // 2. Fallback to Header Exact Match
     for (int32 c = 0; c < StbData.GetColumnCount(); ++c) {
-      if (StbData.GetCell(0, c).ToUpper() == "ZON") {
+      if (StbData.GetCellView(0, c).Equals(FAnsiStringView("ZON"),
+                                           ESearchCase::IgnoreCase)) {
         ZonCol = c;
         goto FoundZonCol;
       }
@@ -103,9 +105,9 @@ FoundZonCol:
 
   for (int32 i = 0; i < StbData.GetRowCount(); ++i) {
     // Basic validation: row must have a ZON file
-    FString ZFile = StbData.GetCell(i, ZonCol);
-    if (ZFile.IsEmpty())
+    if (StbData.GetCellView(i, ZonCol).IsEmpty())
       continue;
+    FString ZFile = StbData.GetCell(i, ZonCol);
 
     TSharedPtr<FZoneRow> Row = MakeShared<FZoneRow>();
     Row->ID = i;
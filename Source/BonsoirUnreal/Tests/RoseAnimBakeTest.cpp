@@ -0,0 +1,122 @@
+#include "Misc/AutomationTest.h"
+#include "RoseFormats.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+
+// CPU copy of RoseAnimWPOCode over the baked texels, after the RGBA16F
+// round trip the anim texture stores them with
+struct FRoseAnimTexSampler {
+  TArray<FLinearColor> Texels;
+  int32 Width = 0;
+
+  explicit FRoseAnimTexSampler(const FRoseAnimClip &Clip) {
+    TArray<FLinearColor> Pixels;
+    Clip.Bake(Pixels);
+    for (const FLinearColor &P : Pixels) {
+      Texels.Add(FLinearColor(FFloat16Color(P)));
+    }
+    Width = Texels.Num() / 3;
+  }
+
+  // The shader samples texel centres: U = (F + 0.5) / Frames, V = Row + 0.5
+  FVector4f Fetch(float Frame, int32 Row) const {
+    const FLinearColor &C = Texels[Row * Width + (int32)Frame];
+    return FVector4f(C.R, C.G, C.B, C.A);
+  }
+
+  FTransform Sample(float Time, float Phase, float Frames, float FPS) const {
+    const float T = FMath::Frac((Time + Phase) * FPS / Frames) * Frames;
+    const float F0 = FMath::Min(FMath::FloorToFloat(T), Frames - 1);
+    const float F1 = FMath::Min(F0 + 1, Frames - 1);
+    const float A = T - FMath::FloorToFloat(T);
+
+    const FVector4f P = FMath::Lerp(Fetch(F0, 0), Fetch(F1, 0), A);
+    const FVector4f Q0 = Fetch(F0, 1);
+    FVector4f Q1 = Fetch(F1, 1);
+    if (Q0.X * Q1.X + Q0.Y * Q1.Y + Q0.Z * Q1.Z + Q0.W * Q1.W < 0.0f) {
+      Q1 = -Q1;
+    }
+    const FVector4f QL = FMath::Lerp(Q0, Q1, A);
+    const FQuat4f Q = FQuat4f(QL.X, QL.Y, QL.Z, QL.W).GetNormalized();
+    const FVector4f S = FMath::Lerp(Fetch(F0, 2), Fetch(F1, 2), A);
+    return FTransform(FQuat(Q), FVector(P.X, P.Y, P.Z),
+                      FVector(S.X, S.Y, S.Z));
+  }
+};
+
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRoseAnimBakeTest, "BonsoirUnreal.Anim.BakedTextureMatchesEvaluate",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRoseAnimBakeTest::RunTest(const FString &Parameters) {
+  FRoseAnimClip Clip;
+  Clip.FPS = 10;
+  Clip.FrameCount = 6;
+  for (int32 f = 0; f < Clip.FrameCount; ++f) {
+    Clip.PosKeys.Add(FVector3f(f * 10.0f, -f * 5.0f, f * f * 2.0f));
+    Clip.RotKeys.Add(FQuat4f(FVector3f(0.3f, 0.2f, 1.0f).GetSafeNormal(),
+                             FMath::DegreesToRadians(f * 20.0f)));
+    Clip.ScaleKeys.Add(FVector3f(1.0f + f * 0.1f, 1.0f, 1.0f - f * 0.05f));
+  }
+  // Same rotation with the opposite sign: the shader must take the short
+  // way like Slerp does
+  Clip.RotKeys[3] = -Clip.RotKeys[3];
+
+  const FRoseAnimTexSampler Tex(Clip);
+  TestEqual(TEXT("Texture width"), Tex.Width, Clip.FrameCount);
+
+  const float Duration = Clip.GetDuration();
+  const float Frame = 1.0f / Clip.FPS;
+  // Key frames, between keys, the held last frame before the loop seam,
+  // just past the seam and a later loop. Exactly on the seam float
+  // rounding picks either end, as it does on the GPU
+  const float Times[] = {0.0f,
+                         Frame * 0.37f,
+                         Frame * 2.5f,
+                         Frame * 3.9f,
+                         Duration - Frame * 0.25f,
+                         Duration + Frame * 0.01f,
+                         Duration + Frame * 0.6f,
+                         Duration * 3.0f + Frame * 4.2f};
+  // Slerp and the shader's normalized lerp differ by well under a degree
+  // at 20 degrees per key
+  const float AngleTolerance = FMath::DegreesToRadians(0.5f);
+  const float Tolerance = 0.05f; // Half float precision at these ranges
+
+  for (const float Time : Times) {
+    const FTransform Expected = Clip.Evaluate(Time);
+    const FTransform Baked =
+        Tex.Sample(Time, 0.0f, Clip.FrameCount, Clip.FPS);
+    const FString At = FString::Printf(TEXT(" at %.3fs"), Time);
+    TestTrue(TEXT("Position") + At,
+             Baked.GetLocation().Equals(Expected.GetLocation(), Tolerance));
+    TestTrue(TEXT("Rotation") + At,
+             Baked.GetRotation().AngularDistance(Expected.GetRotation()) <
+                 AngleTolerance);
+    TestTrue(TEXT("Scale") + At,
+             Baked.GetScale3D().Equals(Expected.GetScale3D(), Tolerance));
+  }
+
+  // A phase is the same as starting the clock later
+  const FTransform Phased = Tex.Sample(0.1f, 0.25f, Clip.FrameCount, Clip.FPS);
+  TestTrue(TEXT("Phase offset"),
+           Phased.GetLocation().Equals(Clip.Evaluate(0.35f).GetLocation(),
+                                       Tolerance));
+
+  // Channels the clip does not animate bake to identity
+  FRoseAnimClip Static;
+  Static.FPS = 30;
+  Static.FrameCount = 4;
+  Static.RotKeys.Add(FQuat4f::Identity);
+  const FTransform Identity =
+      FRoseAnimTexSampler(Static).Sample(0.05f, 0.0f, 4.0f, 30.0f);
+  TestTrue(TEXT("Identity channels"),
+           Identity.Equals(FTransform::Identity, KINDA_SMALL_NUMBER));
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
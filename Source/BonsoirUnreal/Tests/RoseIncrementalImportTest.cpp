@@ -0,0 +1,80 @@
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "RoseAnimManagerComponent.h"
+#include "RoseImportSettings.h"
+#include "RoseImporter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Animated props in the world, over all three placement paths
+static int32 CountRoseAnimatedProps(UWorld *World) {
+  int32 Count = 0;
+  for (TActorIterator<AActor> It(World); It; ++It) {
+    TInlineComponentArray<UActorComponent *> Components(*It);
+    for (UActorComponent *Component : Components) {
+      if (auto *HISM =
+              Cast<UHierarchicalInstancedStaticMeshComponent>(Component)) {
+        if (HISM->GetName().Contains(TEXT("_AnimWPO"))) {
+          Count += HISM->GetInstanceCount();
+        }
+      } else if (auto *Manager =
+                     Cast<URoseAnimManagerComponent>(Component)) {
+        Count += Manager->GetNumInstances();
+      } else if (Component->IsA<URoseAnimComponent>()) {
+        Count++;
+      }
+    }
+  }
+  return Count;
+}
+
+// Needs ROSE data: run with -RoseTestZON=<path to a .ZON with animated props>
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRoseIncrementalWPOReimportTest,
+    "BonsoirUnreal.Import.IncrementalReimportKeepsAnimWPOProps",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRoseIncrementalWPOReimportTest::RunTest(const FString &Parameters) {
+  FString ZONPath;
+  if (!FParse::Value(FCommandLine::Get(), TEXT("RoseTestZON="), ZONPath)) {
+    AddInfo(TEXT("Skipped: no -RoseTestZON= on the command line"));
+    return true;
+  }
+  UWorld *World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+  if (!TestNotNull(TEXT("Editor world"), World))
+    return false;
+
+  URoseImportSettings *Settings = GetMutableDefault<URoseImportSettings>();
+  const bool bWasIncremental = Settings->bIncrementalReimport;
+  const bool bWasWPO = Settings->bBakeAnimatedObjectsToWPO;
+  ON_SCOPE_EXIT {
+    Settings->bIncrementalReimport = bWasIncremental;
+    Settings->bBakeAnimatedObjectsToWPO = bWasWPO;
+  };
+  Settings->bIncrementalReimport = true;
+  Settings->bBakeAnimatedObjectsToWPO = true;
+
+  // The first import writes the manifest; the second finds no changed
+  // source and replays the animated objects of every kept tile
+  if (!TestTrue(TEXT("First import"),
+                NewObject<URoseImporter>()->ImportZone(ZONPath)))
+    return false;
+  const int32 FirstCount = CountRoseAnimatedProps(World);
+  if (!TestTrue(TEXT("Re-import"),
+                NewObject<URoseImporter>()->ImportZone(ZONPath)))
+    return false;
+  const int32 SecondCount = CountRoseAnimatedProps(World);
+
+  if (FirstCount == 0) {
+    AddWarning(TEXT("The test zone places no animated props"));
+  }
+  TestEqual(TEXT("Animated props after an unchanged re-import"), SecondCount,
+            FirstCount);
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,87 @@
+#include "Misc/AutomationTest.h"
+#include "RoseImporter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Mean distance between consecutive instances, as logged by the flush
+static double RoseTestMeanStep(const TArray<FTransform> &Transforms) {
+  double Sum = 0.0;
+  for (int32 i = 1; i < Transforms.Num(); ++i) {
+    Sum += FVector::Dist(Transforms[i - 1].GetLocation(),
+                         Transforms[i].GetLocation());
+  }
+  return Transforms.Num() > 1 ? Sum / (Transforms.Num() - 1) : 0.0;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRoseInstanceSortTest, "BonsoirUnreal.Instances.MortonSort",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRoseInstanceSortTest::RunTest(const FString &Parameters) {
+  // 64 x 64 props 10 m apart in shuffled file order; custom data holds
+  // each prop's grid cell so it can be checked after the sort
+  constexpr int32 Size = 64;
+  constexpr double Spacing = 1000.0;
+  TArray<FIntPoint> Cells;
+  for (int32 Y = 0; Y < Size; ++Y) {
+    for (int32 X = 0; X < Size; ++X) {
+      Cells.Add(FIntPoint(X, Y));
+    }
+  }
+  FRandomStream Shuffle(7);
+  for (int32 i = Cells.Num() - 1; i > 0; --i) {
+    Cells.Swap(i, Shuffle.RandRange(0, i));
+  }
+  TArray<FTransform> Transforms;
+  TArray<float> CustomData;
+  for (const FIntPoint &Cell : Cells) {
+    Transforms.Add(
+        FTransform(FVector(Cell.X * Spacing, Cell.Y * Spacing, 0.0)));
+    CustomData.Append({(float)Cell.X, (float)Cell.Y});
+  }
+
+  const double StepBefore = RoseTestMeanStep(Transforms);
+  const double StartTime = FPlatformTime::Seconds();
+  SortInstancesByMorton(Transforms, &CustomData);
+  const double Seconds = FPlatformTime::Seconds() - StartTime;
+  const double StepAfter = RoseTestMeanStep(Transforms);
+  AddInfo(FString::Printf(TEXT("Mean step %.0f -> %.0f, %d instances in "
+                               "%.3f ms"),
+                          StepBefore, StepAfter, Transforms.Num(),
+                          Seconds * 1000.0));
+
+  TestEqual(TEXT("Instances"), Transforms.Num(), Size * Size);
+  TestEqual(TEXT("Custom data"), CustomData.Num(), Size * Size * 2);
+  bool bDataFollows = true;
+  for (int32 i = 0; i < Transforms.Num(); ++i) {
+    const FVector Loc = Transforms[i].GetLocation();
+    bDataFollows &= Loc.X == CustomData[i * 2] * Spacing &&
+                    Loc.Y == CustomData[i * 2 + 1] * Spacing;
+  }
+  TestTrue(TEXT("Custom data follows its instance"), bDataFollows);
+  // A Z-order walk of a full grid averages under two cells per step
+  TestTrue(TEXT("Mean step"), StepAfter < Spacing * 2.0);
+
+  // Co-located instances keep their file order
+  TArray<FTransform> Stacked;
+  TArray<float> StackedData;
+  for (int32 i = 0; i < 5; ++i) {
+    Stacked.Add(FTransform(FVector(500.0, 500.0, i * 100.0)));
+    StackedData.Add(i);
+  }
+  SortInstancesByMorton(Stacked, &StackedData);
+  TestTrue(TEXT("Stable order"),
+           StackedData == TArray<float>({0.0f, 1.0f, 2.0f, 3.0f, 4.0f}));
+
+  // Custom data that does not split per instance is left alone
+  TArray<float> Odd = {1.0f, 2.0f, 3.0f, 4.0f};
+  TArray<FTransform> Three = {FTransform(FVector(3.0, 0.0, 0.0)),
+                              FTransform(FVector(0.0, 0.0, 0.0)),
+                              FTransform(FVector(1.0, 1.0, 0.0))};
+  SortInstancesByMorton(Three, &Odd);
+  TestTrue(TEXT("Uneven custom data"),
+           Odd == TArray<float>({1.0f, 2.0f, 3.0f, 4.0f}));
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,127 @@
+#include "HAL/MemoryBase.h"
+#include "MeshDescription.h"
+#include "Misc/AutomationTest.h"
+#include "RoseFormats.h"
+#include "RoseImporter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+
+// Forwards to the real allocator and counts the heap calls made by one
+// thread, so other editor threads do not add noise
+class FRoseCountingMalloc final : public FMalloc {
+public:
+  FMalloc *Inner = nullptr;
+  uint32 ThreadId = 0;
+  int64 NumAllocs = 0;
+
+  virtual void *Malloc(SIZE_T Count, uint32 Alignment) override {
+    CountCall();
+    return Inner->Malloc(Count, Alignment);
+  }
+  virtual void *Realloc(void *Original, SIZE_T Count,
+                        uint32 Alignment) override {
+    CountCall();
+    return Inner->Realloc(Original, Count, Alignment);
+  }
+  virtual void Free(void *Original) override { Inner->Free(Original); }
+  virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override {
+    return Inner->QuantizeSize(Count, Alignment);
+  }
+  virtual bool GetAllocationSize(void *Original,
+                                 SIZE_T &SizeOut) override {
+    return Inner->GetAllocationSize(Original, SizeOut);
+  }
+  virtual void Trim(bool bTrimThreadCaches) override {
+    Inner->Trim(bTrimThreadCaches);
+  }
+  virtual bool IsInternallyThreadSafe() const override {
+    return Inner->IsInternallyThreadSafe();
+  }
+  virtual const TCHAR *GetDescriptiveName() override {
+    return TEXT("RoseCountingMalloc");
+  }
+
+private:
+  void CountCall() {
+    if (FPlatformTLS::GetCurrentThreadId() == ThreadId) {
+      NumAllocs++;
+    }
+  }
+};
+
+// Static so a thread that read GMalloc just before it is restored still
+// calls into a live object
+FRoseCountingMalloc GRoseCountingMalloc;
+
+// Indexed Size x Size quad grid, shared corners like a ZMS export
+FRoseZMS MakeRoseIndexedGrid(int32 Size) {
+  FRoseZMS ZMS;
+  for (int32 Y = 0; Y <= Size; ++Y) {
+    for (int32 X = 0; X <= Size; ++X) {
+      FRoseZMS::FVertex V = {};
+      V.Position = FVector3f(X, Y, 0.0f);
+      V.Normal = FVector3f(0.0f, 0.0f, 1.0f);
+      V.UV1 = FVector2f((float)X / Size, (float)Y / Size);
+      ZMS.Vertices.Add(V);
+    }
+  }
+  for (int32 Y = 0; Y < Size; ++Y) {
+    for (int32 X = 0; X < Size; ++X) {
+      const uint32 I = Y * (Size + 1) + X;
+      ZMS.Indices.Append({I, I + 1, I + Size + 2, I, I + Size + 2,
+                          I + Size + 1});
+    }
+  }
+  ZMS.VertCount = ZMS.Vertices.Num();
+  ZMS.FaceCount = ZMS.Indices.Num() / 3;
+  return ZMS;
+}
+
+// Heap calls made by one ZMS -> MeshDescription conversion
+int64 CountRoseMeshDescriptionAllocs(const FRoseZMS &ZMS, double &OutSeconds) {
+  FMeshDescription MD;
+  GRoseCountingMalloc.Inner = GMalloc;
+  GRoseCountingMalloc.ThreadId = FPlatformTLS::GetCurrentThreadId();
+  GRoseCountingMalloc.NumAllocs = 0;
+
+  const double StartTime = FPlatformTime::Seconds();
+  GMalloc = &GRoseCountingMalloc;
+  BuildRoseMeshDescription(ZMS, MD, TEXT("AllocTest"));
+  GMalloc = GRoseCountingMalloc.Inner;
+  OutSeconds = FPlatformTime::Seconds() - StartTime;
+  return GRoseCountingMalloc.NumAllocs;
+}
+
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRoseMeshDescriptionAllocTest,
+    "BonsoirUnreal.MeshDescription.AllocationsPerMesh",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRoseMeshDescriptionAllocTest::RunTest(const FString &Parameters) {
+  const FRoseZMS Small = MakeRoseIndexedGrid(32);
+  const FRoseZMS Large = MakeRoseIndexedGrid(128);
+  double Seconds = 0.0;
+  // Warm up attribute names and other one-time statics
+  CountRoseMeshDescriptionAllocs(Small, Seconds);
+
+  const int64 SmallAllocs = CountRoseMeshDescriptionAllocs(Small, Seconds);
+  AddInfo(FString::Printf(TEXT("%d triangles: %lld allocations, %.3f ms"),
+                          Small.FaceCount, SmallAllocs, Seconds * 1000.0));
+  const int64 LargeAllocs = CountRoseMeshDescriptionAllocs(Large, Seconds);
+  AddInfo(FString::Printf(TEXT("%d triangles: %lld allocations, %.3f ms"),
+                          Large.FaceCount, LargeAllocs, Seconds * 1000.0));
+
+  // Reserved storage: 16x the triangles may only add a handful of
+  // allocations (container growth is logarithmic at worst), never one per
+  // triangle or vertex
+  const int32 ExtraTris = Large.FaceCount - Small.FaceCount;
+  TestTrue(TEXT("Allocations do not scale with triangles"),
+           LargeAllocs - SmallAllocs < ExtraTris / 100);
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,107 @@
+#include "Misc/AutomationTest.h"
+#include "RoseFormats.h"
+#include "RoseMeshOptimizer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Flat Size x Size quad grid as a triangle soup: every triangle carries its
+// own three vertices, like an unindexed export. Rows run longer than the
+// post-transform cache so the source order misses on every vertex
+static FRoseZMS MakeRoseSoupGrid(int32 Size, float Jitter) {
+  FRoseZMS ZMS;
+  auto AddVertex = [&](int32 X, int32 Y) {
+    FRoseZMS::FVertex V = {};
+    V.Position = FVector3f(X, Y, 0.0f);
+    // Copies of one corner differ by less than the weld threshold
+    V.Position.Z += (ZMS.Vertices.Num() % 3) * Jitter;
+    V.Normal = FVector3f(0.0f, 0.0f, 1.0f);
+    V.UV1 = FVector2f((float)X / Size, (float)Y / Size);
+    V.Color = FColor::White;
+    ZMS.Indices.Add(ZMS.Vertices.Add(V));
+  };
+  for (int32 Y = 0; Y < Size; ++Y) {
+    for (int32 X = 0; X < Size; ++X) {
+      AddVertex(X, Y);
+      AddVertex(X + 1, Y);
+      AddVertex(X + 1, Y + 1);
+      AddVertex(X, Y);
+      AddVertex(X + 1, Y + 1);
+      AddVertex(X, Y + 1);
+    }
+  }
+  ZMS.VertCount = ZMS.Vertices.Num();
+  ZMS.FaceCount = ZMS.Indices.Num() / 3;
+  return ZMS;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRoseMeshOptimizerGridTest,
+    "BonsoirUnreal.MeshOptimizer.WeldAndReorderGrid",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRoseMeshOptimizerGridTest::RunTest(const FString &Parameters) {
+  constexpr int32 Size = 64;
+  constexpr float WeldThreshold = 0.01f;
+  FRoseZMS ZMS = MakeRoseSoupGrid(Size, WeldThreshold * 0.25f);
+
+  FRoseMeshOptimizeStats Stats;
+  RoseMeshOptimizer::Optimize(ZMS, WeldThreshold, &Stats);
+  AddInfo(FString::Printf(TEXT("ACMR %.3f -> %.3f, %d -> %d verts, %.2f ms"),
+                          Stats.GetACMRBefore(), Stats.GetACMRAfter(),
+                          Stats.VertsBefore, Stats.VertsAfter,
+                          Stats.Seconds * 1000.0));
+
+  TestEqual(TEXT("Source vertices"), Stats.VertsBefore, Size * Size * 6);
+  TestEqual(TEXT("Welded vertices"), Stats.VertsAfter,
+            (Size + 1) * (Size + 1));
+  TestEqual(TEXT("Vertex array"), ZMS.Vertices.Num(), ZMS.VertCount);
+  TestEqual(TEXT("Triangles kept"), Stats.TrisAfter, Size * Size * 2);
+  TestEqual(TEXT("Index array"), ZMS.Indices.Num(), ZMS.FaceCount * 3);
+  TestEqual(TEXT("Source ACMR"), Stats.GetACMRBefore(), 3.0f);
+  // A regular grid approaches 0.5 with an ideal order; row order through
+  // a 16 entry FIFO stays near 1
+  TestTrue(TEXT("ACMR below row order"), Stats.GetACMRAfter() < 0.9f);
+  TestEqual(TEXT("Stored misses"),
+            RoseMeshOptimizer::CountCacheMisses(ZMS.Indices),
+            Stats.MissesAfter);
+
+  // Vertices are numbered in first-use order
+  uint32 NextNew = 0;
+  bool bFirstUseOrder = true;
+  for (uint32 Index : ZMS.Indices) {
+    if (Index > NextNew) {
+      bFirstUseOrder = false;
+    } else if (Index == NextNew) {
+      NextNew++;
+    }
+  }
+  TestTrue(TEXT("First-use vertex order"), bFirstUseOrder);
+  TestEqual(TEXT("Referenced vertices"), (int32)NextNew, ZMS.VertCount);
+  return true;
+}
+
+// UV seams must survive welding even where positions coincide
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRoseMeshOptimizerSeamTest, "BonsoirUnreal.MeshOptimizer.KeepsUVSeams",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRoseMeshOptimizerSeamTest::RunTest(const FString &Parameters) {
+  constexpr int32 Size = 8;
+  FRoseZMS ZMS = MakeRoseSoupGrid(Size, 0.0f);
+  // Move the right half to its own UV island, so the middle column is
+  // stored once per side. Soup vertices belong to a single triangle
+  for (int32 i = 0; i < ZMS.Indices.Num(); i += 3) {
+    if (ZMS.Vertices[ZMS.Indices[i]].Position.X < Size / 2)
+      continue;
+    for (int32 k = 0; k < 3; ++k) {
+      ZMS.Vertices[ZMS.Indices[i + k]].UV1.X += 1.0f;
+    }
+  }
+
+  RoseMeshOptimizer::Optimize(ZMS, 0.01f);
+  TestEqual(TEXT("Welded vertices with a seam"), ZMS.VertCount,
+            (Size + 1) * (Size + 1) + (Size + 1));
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS